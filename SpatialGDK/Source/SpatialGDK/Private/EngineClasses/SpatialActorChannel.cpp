@@ -80,6 +80,7 @@ USpatialActorChannel::USpatialActorChannel(const FObjectInitializer& ObjectIniti
 	, EntityId(SpatialConstants::INVALID_ENTITY_ID)
 	, bInterestDirty(false)
 	, bNetOwned(false)
+	, bOwnerCacheValid(false)
 	, NetDriver(nullptr)
 	, LastPositionSinceUpdate(FVector::ZeroVector)
 	, TimeWhenPositionLastUpdated(0.0f)
@@ -223,15 +224,6 @@ void USpatialActorChannel::UpdateShadowData()
 	}
 }
 
-void USpatialActorChannel::UpdateSpatialPositionWithFrequencyCheck()
-{
-	// Check that there has been a sufficient amount of time since the last update.
-	if ((NetDriver->Time - TimeWhenPositionLastUpdated) >= (1.0f / GetDefault<USpatialGDKSettings>()->PositionUpdateFrequency))
-	{
-		UpdateSpatialPosition();
-	}
-}
-
 FRepChangeState USpatialActorChannel::CreateInitialRepChangeState(TWeakObjectPtr<UObject> Object)
 {
 	checkf(Object != nullptr, TEXT("Attempted to create initial rep change state on an object which is null."));
@@ -366,7 +358,7 @@ int64 USpatialActorChannel::ReplicateActor()
 		}
 		else
 		{
-			UpdateSpatialPositionWithFrequencyCheck();
+			UpdateSpatialPosition();
 		}
 	}
 	
@@ -785,6 +777,8 @@ FHandoverChangeState USpatialActorChannel::GetHandoverChangeList(TArray<uint8>&
 void USpatialActorChannel::SetChannelActor(AActor* InActor)
 {
 	Super::SetChannelActor(InActor);
+
+	PositionUpdatePolicy = GetDefault<USpatialGDKSettings>()->GetPositionUpdatePolicyForClass(InActor->GetClass());
 	
 	USpatialPackageMapClient* PackageMap = NetDriver->PackageMap;
 	EntityId = PackageMap->GetEntityIdFromObject(InActor);
@@ -930,20 +924,22 @@ void USpatialActorChannel::UpdateSpatialPosition()
 	// we want to defer updating position until we reach the highest parent.
 	AActor* ActorOwner = Actor->GetOwner();
 
-	if ((ActorOwner != nullptr || Actor->GetNetConnection() != nullptr) && !Actor->IsA<APlayerController>())
+	UNetConnection* OwnerConnection = GetOwnerNetConnection();
+	if ((ActorOwner != nullptr || OwnerConnection != nullptr) && !Actor->IsA<APlayerController>())
 	{
 		// If this Actor's owner is not replicated (e.g. parent = AI Controller), the actor will not have it's spatial
 		// position updated as this code will never be run for the parent. 
-		if (!(Actor->GetNetConnection() == nullptr && ActorOwner != nullptr && !ActorOwner->GetIsReplicated()))
+		if (!(OwnerConnection == nullptr && ActorOwner != nullptr && !ActorOwner->GetIsReplicated()))
 		{
 			return;
 		}
 	}
 
-	// Check that the Actor has moved sufficiently far to be updated
-	const float SpatialPositionThresholdSquared = FMath::Square(GetDefault<USpatialGDKSettings>()->PositionDistanceThreshold);
+	// Check that enough time has passed and the Actor has moved sufficiently far to be updated, according to the policy of its class.
 	FVector ActorSpatialPosition = GetActorSpatialPosition(Actor);
-	if (FVector::DistSquared(ActorSpatialPosition, LastPositionSinceUpdate) < SpatialPositionThresholdSquared)
+	const float DistanceMoved = FVector::Dist(ActorSpatialPosition, LastPositionSinceUpdate);
+	const float ViewerDistance = PositionUpdatePolicy.ViewerDistanceThresholdScale > 0.0f ? NetDriver->GetDistanceToNearestViewer(ActorSpatialPosition) : 0.0f;
+	if (!PositionUpdatePolicy.ShouldSendUpdate(DistanceMoved, NetDriver->Time - TimeWhenPositionLastUpdated, ViewerDistance))
 	{
 		return;
 	}
@@ -977,6 +973,16 @@ void USpatialActorChannel::SendPositionUpdate(AActor* InActor, Worker_EntityId I
 
 FVector USpatialActorChannel::GetActorSpatialPosition(AActor* InActor)
 {
+	// Skip the part of the owner chain that only forwards to the owner's position.
+	if (InActor == Actor && NetDriver->IsServer())
+	{
+		ResolveOwnerCache();
+		if (AActor* PositionActor = CachedPositionActor.Get())
+		{
+			InActor = PositionActor;
+		}
+	}
+
 	FVector Location = FVector::ZeroVector;
 
 	// If the Actor is a Controller, use its Pawn's position,
@@ -1002,6 +1008,60 @@ FVector USpatialActorChannel::GetActorSpatialPosition(AActor* InActor)
 	return FRepMovement::RebaseOntoZeroOrigin(Location, InActor);
 }
 
+UNetConnection* USpatialActorChannel::GetOwnerNetConnection()
+{
+	if (!NetDriver->IsServer())
+	{
+		return Actor->GetNetConnection();
+	}
+
+	ResolveOwnerCache();
+	return CachedOwnerConnection.Get();
+}
+
+const FString& USpatialActorChannel::GetOwnerWorkerAttribute()
+{
+	if (!NetDriver->IsServer())
+	{
+		CachedOwnerWorkerAttribute = SpatialGDK::GetOwnerWorkerAttribute(Actor);
+		return CachedOwnerWorkerAttribute;
+	}
+
+	ResolveOwnerCache();
+	return CachedOwnerWorkerAttribute;
+}
+
+void USpatialActorChannel::InvalidateOwnerCache()
+{
+	bOwnerCacheValid = false;
+}
+
+void USpatialActorChannel::ResolveOwnerCache()
+{
+	// A connection that went away since it was cached has to be resolved again.
+	if (bOwnerCacheValid && (CachedOwnerConnection.IsValid() || CachedOwnerConnection.IsExplicitlyNull()) && CachedPositionActor.IsValid())
+	{
+		return;
+	}
+
+	// Resolved lazily rather than in InvalidateOwnerCache, as e.g. a pawn's controller is only updated after its owner.
+	UNetConnection* OwnerConnection = Actor->GetNetConnection();
+	CachedOwnerConnection = OwnerConnection;
+
+	const USpatialNetConnection* SpatialOwnerConnection = Cast<USpatialNetConnection>(OwnerConnection);
+	CachedOwnerWorkerAttribute = SpatialOwnerConnection != nullptr ? SpatialOwnerConnection->WorkerAttribute : FString();
+
+	// Mirrors the recursion in GetActorSpatialPosition, stopping at controllers as their pawn can change without an owner update.
+	AActor* PositionActor = Actor;
+	while (!PositionActor->IsA<AController>() && PositionActor->GetOwner() != nullptr && PositionActor->GetIsReplicated())
+	{
+		PositionActor = PositionActor->GetOwner();
+	}
+	CachedPositionActor = PositionActor;
+
+	bOwnerCacheValid = true;
+}
+
 void USpatialActorChannel::RemoveRepNotifiesWithUnresolvedObjs(TArray<UProperty*>& RepNotifies, const FRepLayout& RepLayout, const FObjectReferencesMap& RefMap, UObject* Object)
 {
 	// Prevent rep notify callbacks from being issued when unresolved obj references exist inside UStructs.
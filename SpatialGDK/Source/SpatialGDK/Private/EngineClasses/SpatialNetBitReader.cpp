@@ -54,7 +54,7 @@ FArchive& FSpatialNetBitReader::operator<<(UObject*& Value)
 	{
 		auto PackageMapClient = Cast<USpatialPackageMapClient>(PackageMap);
 		FNetworkGUID NetGUID = PackageMapClient->GetNetGUIDFromUnrealObjectRef(ObjectRef);
-		if (NetGUID.IsValid())
+		if (NetGUID.IsValid() && !PackageMapClient->TryAsyncLoadStablyNamedObject(NetGUID, ObjectRef))
 		{
 			Value = PackageMapClient->GetObjectFromNetGUID(NetGUID, true);
 			if (Value == nullptr)
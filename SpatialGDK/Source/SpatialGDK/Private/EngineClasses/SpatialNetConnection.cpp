@@ -2,8 +2,6 @@
 
 #include "EngineClasses/SpatialNetConnection.h"
 
-#include "TimerManager.h"
-
 #include "EngineClasses/SpatialNetDriver.h"
 #include "EngineClasses/SpatialPackageMapClient.h"
 #include "Gameframework/PlayerController.h"
@@ -21,6 +19,7 @@ DEFINE_LOG_CATEGORY(LogSpatialNetConnection);
 USpatialNetConnection::USpatialNetConnection(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, PlayerControllerEntity(SpatialConstants::INVALID_ENTITY_ID)
+	, LastHeartbeatSentTime(0.0)
 {
 	InternalAck = 1;
 }
@@ -127,67 +126,54 @@ void USpatialNetConnection::ClientNotifyClientHasQuit()
 	}
 }
 
-void USpatialNetConnection::InitHeartbeat(FTimerManager* InTimerManager, Worker_EntityId InPlayerControllerEntity)
+void USpatialNetConnection::InitHeartbeat(Worker_EntityId InPlayerControllerEntity)
 {
 	checkf(PlayerControllerEntity == SpatialConstants::INVALID_ENTITY_ID, TEXT("InitHeartbeat: PlayerControllerEntity already set: %lld. New entity: %lld"), PlayerControllerEntity, InPlayerControllerEntity);
 	PlayerControllerEntity = InPlayerControllerEntity;
-	TimerManager = InTimerManager;
 
-	if (Driver->IsServer())
-	{
-		SetHeartbeatTimeoutTimer();
-	}
-	else
-	{
-		SetHeartbeatEventTimer();
-	}
+	// Servers track heartbeats of all their clients in USpatialReceiver, clients send their first heartbeat on the next tick.
+	LastHeartbeatSentTime = 0.0;
 }
 
-void USpatialNetConnection::SetHeartbeatTimeoutTimer()
+void USpatialNetConnection::DisableHeartbeat()
 {
-	TimerManager->SetTimer(HeartbeatTimer, [WeakThis = TWeakObjectPtr<USpatialNetConnection>(this)]()
-	{
-		if (USpatialNetConnection* Connection = WeakThis.Get())
-		{
-			// This client timed out. Disconnect it and trigger OnDisconnected logic.
-			Connection->CleanUp();
-		}
-	}, GetDefault<USpatialGDKSettings>()->HeartbeatTimeoutSeconds, false);
+	PlayerControllerEntity = SpatialConstants::INVALID_ENTITY_ID;
 }
 
-void USpatialNetConnection::SetHeartbeatEventTimer()
+void USpatialNetConnection::ClientTickHeartbeat()
 {
-	TimerManager->SetTimer(HeartbeatTimer, [WeakThis = TWeakObjectPtr<USpatialNetConnection>(this)]()
+	if (PlayerControllerEntity == SpatialConstants::INVALID_ENTITY_ID)
 	{
-		if (USpatialNetConnection* Connection = WeakThis.Get())
-		{
-			Worker_ComponentUpdate ComponentUpdate = {};
-
-			ComponentUpdate.component_id = SpatialConstants::HEARTBEAT_COMPONENT_ID;
-			ComponentUpdate.schema_type = Schema_CreateComponentUpdate(SpatialConstants::HEARTBEAT_COMPONENT_ID);
-			Schema_Object* EventsObject = Schema_GetComponentUpdateEvents(ComponentUpdate.schema_type);
-			Schema_AddObject(EventsObject, SpatialConstants::HEARTBEAT_EVENT_ID);
-
-			USpatialWorkerConnection* WorkerConnection = Cast<USpatialNetDriver>(Connection->Driver)->Connection;
-			if (WorkerConnection->IsConnected())
-			{
-				WorkerConnection->SendComponentUpdate(Connection->PlayerControllerEntity, &ComponentUpdate);
-			}
-		}
-	}, GetDefault<USpatialGDKSettings>()->HeartbeatIntervalSeconds, true, 0.0f);
-}
+		return;
+	}
 
-void USpatialNetConnection::DisableHeartbeat()
-{
-	// Remove the heartbeat callback
-	if (TimerManager != nullptr && HeartbeatTimer.IsValid())
+	const double Now = FPlatformTime::Seconds();
+	if (Now - LastHeartbeatSentTime < GetDefault<USpatialGDKSettings>()->HeartbeatIntervalSeconds)
 	{
-		TimerManager->ClearTimer(HeartbeatTimer);
+		return;
 	}
-	PlayerControllerEntity = SpatialConstants::INVALID_ENTITY_ID;
+
+	USpatialWorkerConnection* WorkerConnection = Cast<USpatialNetDriver>(Driver)->Connection;
+	if (!WorkerConnection->IsConnected())
+	{
+		return;
+	}
+
+	Worker_ComponentUpdate ComponentUpdate = {};
+
+	ComponentUpdate.component_id = SpatialConstants::HEARTBEAT_COMPONENT_ID;
+	ComponentUpdate.schema_type = Schema_CreateComponentUpdate(SpatialConstants::HEARTBEAT_COMPONENT_ID);
+	Schema_Object* EventsObject = Schema_GetComponentUpdateEvents(ComponentUpdate.schema_type);
+	Schema_AddObject(EventsObject, SpatialConstants::HEARTBEAT_EVENT_ID);
+
+	WorkerConnection->SendComponentUpdate(PlayerControllerEntity, &ComponentUpdate);
+	LastHeartbeatSentTime = Now;
 }
 
-void USpatialNetConnection::OnHeartbeat()
+void USpatialNetConnection::ClientOnUpdateSent(Worker_EntityId EntityId)
 {
-	SetHeartbeatTimeoutTimer();
+	if (EntityId != SpatialConstants::INVALID_ENTITY_ID && EntityId == PlayerControllerEntity)
+	{
+		LastHeartbeatSentTime = FPlatformTime::Seconds();
+	}
 }
@@ -34,6 +34,7 @@
 #include "Utils/EntityPool.h"
 #include "Utils/InterestFactory.h"
 #include "Utils/OpUtils.h"
+#include "Utils/RPCParameterCodec.h"
 #include "Utils/SpatialMetrics.h"
 #include "Utils/SpatialMetricsDisplay.h"
 
@@ -639,6 +640,17 @@ void USpatialNetDriver::NotifyActorDestroyed(AActor* ThisActor, bool IsSeamlessT
 	RenamedStartupActors.Remove(ThisActor->GetFName());
 }
 
+bool USpatialNetDriver::ShouldClientDestroyActor(AActor* Actor) const
+{
+	// Actors returned to the client Actor pool are deactivated by the receiver instead of being destroyed.
+	if (Receiver != nullptr && Receiver->IsRecyclingActor(Actor))
+	{
+		return false;
+	}
+
+	return Super::ShouldClientDestroyActor(Actor);
+}
+
 void USpatialNetDriver::Shutdown()
 {
 	if (!IsServer())
@@ -667,6 +679,9 @@ void USpatialNetDriver::OnOwnerUpdated(AActor* Actor)
 		return;
 	}
 
+	// Done before looking up the channel, as actors owned by this one can have channels even if it doesn't have one itself.
+	InvalidateOwnerCache(Actor);
+
 	Worker_EntityId EntityId = PackageMap->GetEntityIdFromObject(Actor);
 	if (EntityId == SpatialConstants::INVALID_ENTITY_ID)
 	{
@@ -684,6 +699,24 @@ void USpatialNetDriver::OnOwnerUpdated(AActor* Actor)
 	Channel->ServerProcessOwnershipChange();
 }
 
+void USpatialNetDriver::InvalidateOwnerCache(AActor* Actor)
+{
+	// The owner chain of everything this actor owns goes through it, so their cached owners are out of date as well.
+	Worker_EntityId EntityId = PackageMap->GetEntityIdFromObject(Actor);
+	if (USpatialActorChannel* Channel = GetActorChannelByEntityId(EntityId))
+	{
+		Channel->InvalidateOwnerCache();
+	}
+
+	for (AActor* Child : Actor->Children)
+	{
+		if (Child != nullptr)
+		{
+			InvalidateOwnerCache(Child);
+		}
+	}
+}
+
 //SpatialGDK: Functions in the ifdef block below are modified versions of the UNetDriver:: implementations.
 #if WITH_SERVER_CODE
 
@@ -1216,20 +1249,25 @@ void USpatialNetDriver::TickDispatch(float DeltaTime)
 
 	if (Connection != nullptr)
 	{
-		TArray<Worker_OpList*> OpLists = Connection->GetOpList();
+		Connection->GetOpList(OpListsToProcess);
 
 		// Servers will queue ops at startup until we've extracted necessary information from the op stream
 		if (!bIsReadyToStart)
 		{
-			HandleStartupOpQueueing(OpLists);
+			HandleStartupOpQueueing(OpListsToProcess);
 			return;
 		}
 
-		for (Worker_OpList* OpList : OpLists)
 		{
-			Dispatcher->ProcessOps(OpList);
+			FSpatialLoadScope LoadScope(SpatialMetrics, ESpatialLoadSubsystem::OpProcessing);
 
-			Worker_OpList_Destroy(OpList);
+			for (Worker_OpList* OpList : OpListsToProcess)
+			{
+				Dispatcher->ProcessOps(OpList);
+
+				Worker_OpList_Destroy(OpList);
+			}
+			OpListsToProcess.Reset();
 		}
 
 		if (SpatialMetrics != nullptr && GetDefault<USpatialGDKSettings>()->bEnableMetrics)
@@ -1315,6 +1353,7 @@ void USpatialNetDriver::ProcessRemoteFunction(
 
 	if (Function->FunctionFlags & FUNC_Net)
 	{
+		FSpatialLoadScope LoadScope(SpatialMetrics, ESpatialLoadSubsystem::RPC);
 		ProcessRPC(Actor, SubObject, Function, Parameters);
 	}
 }
@@ -1337,7 +1376,14 @@ void USpatialNetDriver::TickFlush(float DeltaTime)
 		double ServerReplicateActorsTimeStart = FPlatformTime::Seconds();
 #endif // USE_SERVER_PERF_COUNTERS
 
-		int32 Updated = ServerReplicateActors(DeltaTime);
+		// Position updates compare against viewer locations for every replicated Actor, so gather them once.
+		UpdateViewerLocations();
+
+		int32 Updated = 0;
+		{
+			FSpatialLoadScope LoadScope(SpatialMetrics, ESpatialLoadSubsystem::Replication);
+			Updated = ServerReplicateActors(DeltaTime);
+		}
 
 #if USE_SERVER_PERF_COUNTERS
 		ServerReplicateActorsTimeMs = (FPlatformTime::Seconds() - ServerReplicateActorsTimeStart) * 1000.0;
@@ -1355,7 +1401,8 @@ void USpatialNetDriver::TickFlush(float DeltaTime)
 
 		if (SpatialGDKSettings->bBatchSpatialPositionUpdates && Sender != nullptr)
 		{
-			if ((Time - TimeWhenPositionLastUpdated) >= (1.0f / SpatialGDKSettings->PositionUpdateFrequency))
+			// Individual channels check their own policy, so the batch has to run as often as the most frequent one allows.
+			if ((Time - TimeWhenPositionLastUpdated) >= SpatialGDKSettings->GetMinPositionUpdateInterval())
 			{
 				TimeWhenPositionLastUpdated = Time;
 
@@ -1366,9 +1413,38 @@ void USpatialNetDriver::TickFlush(float DeltaTime)
 #endif // WITH_SERVER_CODE
 	}
 
-	if (GetDefault<USpatialGDKSettings>()->bPackRPCs && Sender != nullptr)
 	{
-		Sender->FlushPackedRPCs();
+		FSpatialLoadScope LoadScope(SpatialMetrics, ESpatialLoadSubsystem::RPC);
+
+		if (GetDefault<USpatialGDKSettings>()->bPackRPCs && Sender != nullptr)
+		{
+			Sender->FlushPackedRPCs();
+		}
+
+		if (GetDefault<USpatialGDKSettings>()->bBatchRPCEvents && Sender != nullptr)
+		{
+			Sender->FlushBatchedRPCs();
+		}
+
+		if (GetDefault<USpatialGDKSettings>()->bBatchCrossServerRPCs && Sender != nullptr)
+		{
+			Sender->FlushCrossServerRPCs();
+		}
+	}
+
+	if (IsServer())
+	{
+		if (Receiver != nullptr)
+		{
+			Receiver->CheckClientHeartbeats();
+		}
+	}
+	else
+	{
+		if (USpatialNetConnection* NetConnection = GetSpatialOSNetConnection())
+		{
+			NetConnection->ClientTickHeartbeat();
+		}
 	}
 
 	// Tick the timer manager
@@ -1684,6 +1760,37 @@ USpatialActorChannel* USpatialNetDriver::GetActorChannelByEntityId(Worker_Entity
 	return EntityToActorChannel.FindRef(EntityId);
 }
 
+void USpatialNetDriver::UpdateViewerLocations()
+{
+	ViewerLocations.Reset();
+
+	// The first connection is the connection to SpatialOS, the rest represent the clients this server has authority over.
+	for (int32 i = 1; i < ClientConnections.Num(); i++)
+	{
+		if (const AActor* ViewTarget = ClientConnections[i]->ViewTarget)
+		{
+			ViewerLocations.Add(ViewTarget->GetActorLocation());
+		}
+	}
+}
+
+float USpatialNetDriver::GetDistanceToNearestViewer(const FVector& Location) const
+{
+	// Without any viewers, we can't tell how far away the Actor is from being seen.
+	if (ViewerLocations.Num() == 0)
+	{
+		return 0.0f;
+	}
+
+	float MinDistanceSquared = TNumericLimits<float>::Max();
+	for (const FVector& ViewerLocation : ViewerLocations)
+	{
+		MinDistanceSquared = FMath::Min(MinDistanceSquared, FVector::DistSquared(Location, ViewerLocation));
+	}
+
+	return FMath::Sqrt(MinDistanceSquared);
+}
+
 USpatialActorChannel* USpatialNetDriver::CreateSpatialActorChannel(AActor* Actor, USpatialNetConnection* InConnection)
 {
 	if (InConnection == nullptr)
@@ -1832,6 +1939,16 @@ void USpatialNetDriver::DelayedSendDeleteEntityRequest(Worker_EntityId EntityId,
 	}, Delay, false);
 }
 
+TSharedPtr<FRPCParameterCodec> USpatialNetDriver::GetRPCParameterCodec(UFunction* Function)
+{
+	if (TSharedPtr<FRPCParameterCodec>* Codec = RPCParameterCodecs.Find(Function))
+	{
+		return *Codec;
+	}
+
+	return RPCParameterCodecs.Add(Function, MakeShared<FRPCParameterCodec>(GetFunctionRepLayout(Function)));
+}
+
 void USpatialNetDriver::HandleStartupOpQueueing(const TArray<Worker_OpList*>& InOpLists)
 {
 	if (InOpLists.Num() == 0)
@@ -5,6 +5,7 @@
 #include "EngineUtils.h"
 #include "Engine/Engine.h"
 #include "GameFramework/Actor.h"
+#include "Misc/PackageName.h"
 
 #include "EngineClasses/SpatialActorChannel.h"
 #include "EngineClasses/SpatialNetDriver.h"
@@ -13,6 +14,7 @@
 #include "Interop/SpatialSender.h"
 #include "Schema/UnrealObjectRef.h"
 #include "SpatialConstants.h"
+#include "SpatialGDKSettings.h"
 #include "Utils/EntityPool.h"
 #include "Utils/SchemaOption.h"
 #include "UObject/UObjectGlobals.h"
@@ -204,7 +206,7 @@ FNetworkGUID USpatialPackageMapClient::GetNetGUIDFromEntityId(const Worker_Entit
 TWeakObjectPtr<UObject> USpatialPackageMapClient::GetObjectFromUnrealObjectRef(const FUnrealObjectRef& ObjectRef)
 {
 	FNetworkGUID NetGUID = GetNetGUIDFromUnrealObjectRef(ObjectRef);
-	if (NetGUID.IsValid() && !NetGUID.IsDefault())
+	if (NetGUID.IsValid() && !NetGUID.IsDefault() && !TryAsyncLoadStablyNamedObject(NetGUID, ObjectRef))
 	{
 		return GetObjectFromNetGUID(NetGUID, true);
 	}
@@ -240,6 +242,91 @@ Worker_EntityId USpatialPackageMapClient::GetEntityIdFromObject(const UObject* O
 	return GetUnrealObjectRefFromNetGUID(NetGUID).Entity;
 }
 
+bool USpatialPackageMapClient::TryAsyncLoadStablyNamedObject(const FNetworkGUID& NetGUID, const FUnrealObjectRef& ObjectRef)
+{
+	if (!ObjectRef.Path.IsSet() || !GetDefault<USpatialGDKSettings>()->bAsyncLoadNewClassesOnEntityCheckout)
+	{
+		return false;
+	}
+
+	// Almost every ref points at an object that is already loaded, so check the GUID cache before doing any path or package lookups.
+	if (const FNetGuidCacheObject* CacheObject = GuidCache->ObjectLookup.Find(NetGUID))
+	{
+		if (CacheObject->Object.IsValid())
+		{
+			return false;
+		}
+	}
+
+	// The outermost path of a stably named object is its package.
+	const FUnrealObjectRef* PackageRef = &ObjectRef;
+	while (true)
+	{
+		if (PackageRef->bNoLoadOnClient)
+		{
+			return false;
+		}
+		if (!PackageRef->Outer.IsSet())
+		{
+			break;
+		}
+		PackageRef = &PackageRef->Outer.GetValue();
+	}
+
+	if (!PackageRef->Path.IsSet())
+	{
+		return false;
+	}
+
+	FString PackagePath = PackageRef->Path.GetValue();
+	GEngine->NetworkRemapPath(NetDriver, PackagePath, true);
+	const FName PackageName(*PackagePath);
+
+	if (TArray<FUnrealObjectRef>* PendingObjectRefs = AsyncLoadingPackages.Find(PackageName))
+	{
+		PendingObjectRefs->AddUnique(ObjectRef);
+		return true;
+	}
+
+	if (!FPackageName::IsValidLongPackageName(PackagePath) || FindPackage(nullptr, *PackagePath) != nullptr)
+	{
+		return false;
+	}
+
+	UE_LOG(LogSpatialPackageMap, Verbose, TEXT("Loading package %s asynchronously for stably named object ref %s."), *PackagePath, *ObjectRef.ToString());
+
+	AsyncLoadingPackages.Add(PackageName).Add(ObjectRef);
+	LoadPackageAsync(PackagePath, FLoadPackageAsyncDelegate::CreateUObject(this, &USpatialPackageMapClient::OnStablyNamedObjectPackageLoaded));
+	return true;
+}
+
+void USpatialPackageMapClient::OnStablyNamedObjectPackageLoaded(const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result)
+{
+	TArray<FUnrealObjectRef> PendingObjectRefs;
+	if (!AsyncLoadingPackages.RemoveAndCopyValue(PackageName, PendingObjectRefs))
+	{
+		return;
+	}
+
+	if (Result != EAsyncLoadingResult::Succeeded)
+	{
+		UE_LOG(LogSpatialPackageMap, Error, TEXT("Failed to load package %s asynchronously. References to %d objects in it will stay unresolved."), *PackageName.ToString(), PendingObjectRefs.Num());
+		return;
+	}
+
+	for (const FUnrealObjectRef& ObjectRef : PendingObjectRefs)
+	{
+		if (UObject* Object = GetObjectFromUnrealObjectRef(ObjectRef).Get())
+		{
+			NetDriver->Receiver->ResolvePendingOperations(Object, ObjectRef);
+		}
+		else
+		{
+			UE_LOG(LogSpatialPackageMap, Warning, TEXT("Loaded package %s asynchronously, but it doesn't contain stably named object ref %s. References to it will stay unresolved."), *PackageName.ToString(), *ObjectRef.ToString());
+		}
+	}
+}
+
 bool USpatialPackageMapClient::CanClientLoadObject(UObject* Object)
 {
 	FNetworkGUID NetGUID = GetNetGUIDFromObject(Object);
@@ -422,15 +509,15 @@ void FSpatialNetGUIDCache::RemoveEntityNetGUID(Worker_EntityId EntityId)
 		return;
 	}
 
-	SpatialGDK::TSchemaOption<FUnrealObjectRef>& StablyNamedRefOption = UnrealMetadata->StablyNamedRef;
+	const SpatialGDK::TSchemaOption<FUnrealObjectRef>& StablyNamedRefOption = UnrealMetadata->StablyNamedRef;
 
 	if (UnrealMetadata->NativeClass.IsStale())
 	{
-		UE_LOG(LogSpatialPackageMap, Warning, TEXT("Attempting to remove stale object from package map - %s"), *UnrealMetadata->ClassPath);
+		UE_LOG(LogSpatialPackageMap, Warning, TEXT("Attempting to remove stale object from package map - %s"), *UnrealMetadata->GetClassDescription());
 	}
 	else
 	{
-		const FClassInfo& Info = SpatialNetDriver->ClassInfoManager->GetOrCreateClassInfoByClass(UnrealMetadata->GetNativeEntityClass());
+		const FClassInfo& Info = SpatialNetDriver->ClassInfoManager->GetOrCreateClassInfoByClass(UnrealMetadata->GetNativeEntityClass(SpatialNetDriver->ClassInfoManager));
 
 		for (auto& SubobjectInfoPair : Info.SubobjectInfo)
 		{
@@ -503,16 +590,16 @@ void FSpatialNetGUIDCache::RemoveSubobjectNetGUID(const FUnrealObjectRef& Subobj
 
 	if (UnrealMetadata->NativeClass.IsStale())
 	{
-		UE_LOG(LogSpatialPackageMap, Warning, TEXT("Attempting to remove stale subobject from package map - %s"), *UnrealMetadata->ClassPath);
+		UE_LOG(LogSpatialPackageMap, Warning, TEXT("Attempting to remove stale subobject from package map - %s"), *UnrealMetadata->GetClassDescription());
 	}
 	else
 	{
-		const FClassInfo& Info = SpatialNetDriver->ClassInfoManager->GetOrCreateClassInfoByClass(UnrealMetadata->GetNativeEntityClass());
+		const FClassInfo& Info = SpatialNetDriver->ClassInfoManager->GetOrCreateClassInfoByClass(UnrealMetadata->GetNativeEntityClass(SpatialNetDriver->ClassInfoManager));
 
 		// Part of the CDO
 		if (const TSharedRef<const FClassInfo>* SubobjectInfoPtr = Info.SubobjectInfo.Find(SubobjectRef.Offset))
 		{
-			SpatialGDK::TSchemaOption<FUnrealObjectRef>& StablyNamedRefOption = UnrealMetadata->StablyNamedRef;
+			const SpatialGDK::TSchemaOption<FUnrealObjectRef>& StablyNamedRefOption = UnrealMetadata->StablyNamedRef;
 
 			if (StablyNamedRefOption.IsSet())
 			{
@@ -25,6 +25,9 @@ using namespace SpatialGDK;
 void USpatialWorkerConnection::Init(USpatialGameInstance* InGameInstance)
 {
 	GameInstance = InGameInstance;
+
+	// One more than the capacity, as the circular queue keeps a slot free to tell a full queue from an empty one.
+	OpListQueue = MakeUnique<TCircularQueue<FQueuedOpList>>(FMath::Max(GetDefault<USpatialGDKSettings>()->OpListQueueCapacity, 2u) + 1);
 }
 
 void USpatialWorkerConnection::FinishDestroy()
@@ -43,6 +46,8 @@ void USpatialWorkerConnection::DestroyConnection()
 		OpsProcessingThread = nullptr;
 	}
 
+	DestroyQueuedOpLists();
+
 	if (WorkerConnection)
 	{
 		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WorkerConnection = WorkerConnection]
@@ -320,17 +325,37 @@ SpatialConnectionType USpatialWorkerConnection::GetConnectionType() const
 	}
 }
 
-TArray<Worker_OpList*> USpatialWorkerConnection::GetOpList()
+void USpatialWorkerConnection::GetOpList(TArray<Worker_OpList*>& OutOpLists)
 {
-	TArray<Worker_OpList*> OpLists;
-	while (!OpListQueue.IsEmpty())
+	OutOpLists.Reset();
+
+	if (!OpListQueue.IsValid())
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	OpListQueueStats.MaxDepth = FMath::Max(OpListQueueStats.MaxDepth, static_cast<int32>(OpListQueue->Count()));
+
+	FQueuedOpList QueuedOpList;
+	while (OpListQueue->Dequeue(QueuedOpList))
 	{
-		Worker_OpList* OutOpList;
-		OpListQueue.Dequeue(OutOpList);
-		OpLists.Add(OutOpList);
+		OutOpLists.Add(QueuedOpList.OpList);
+
+		const double DwellTime = Now - QueuedOpList.QueueTime;
+		OpListQueueStats.TotalDwellTime += DwellTime;
+		OpListQueueStats.MaxDwellTime = FMath::Max(OpListQueueStats.MaxDwellTime, DwellTime);
 	}
 
-	return OpLists;
+	OpListQueueStats.NumOpLists += OutOpLists.Num();
+}
+
+FOpListQueueStats USpatialWorkerConnection::TakeOpListQueueStats()
+{
+	FOpListQueueStats Stats = OpListQueueStats;
+	Stats.NumTimesFull = OpListQueueFullCount.Reset();
+	OpListQueueStats = FOpListQueueStats();
+	return Stats;
 }
 
 Worker_RequestId USpatialWorkerConnection::SendReserveEntityIdsRequest(uint32_t NumOfEntities)
@@ -481,6 +506,7 @@ void USpatialWorkerConnection::OnConnectionFailure()
 bool USpatialWorkerConnection::Init()
 {
 	OpsUpdateInterval = 1.0f / GetDefault<USpatialGDKSettings>()->OpsUpdateRate;
+	bLeaveOpsInSDKWhenQueueFull = GetDefault<USpatialGDKSettings>()->bLeaveOpsInSDKWhenOpListQueueFull;
 
 	return true;
 }
@@ -514,10 +540,33 @@ void USpatialWorkerConnection::InitializeOpsProcessingThread()
 
 void USpatialWorkerConnection::QueueLatestOpList()
 {
+	// Op lists that didn't fit before go first, to keep the order.
+	FQueuedOpList* OverflowOpList = nullptr;
+	while ((OverflowOpList = OverflowOpLists.Peek()) != nullptr && OpListQueue->Enqueue(*OverflowOpList))
+	{
+		OverflowOpLists.Pop();
+	}
+	bool bHasOverflowOpLists = OverflowOpList != nullptr;
+
+	if (bHasOverflowOpLists || OpListQueue->IsFull())
+	{
+		OpListQueueFullCount.Increment();
+
+		// The game thread is falling behind, leave the ops in the worker SDK until it catches up.
+		if (bLeaveOpsInSDKWhenQueueFull)
+		{
+			return;
+		}
+	}
+
 	Worker_OpList* OpList = Worker_Connection_GetOpList(WorkerConnection, 0);
 	if (OpList->op_count > 0)
 	{
-		OpListQueue.Enqueue(OpList);
+		const FQueuedOpList QueuedOpList{ OpList, FPlatformTime::Seconds() };
+		if (bHasOverflowOpLists || !OpListQueue->Enqueue(QueuedOpList))
+		{
+			OverflowOpLists.Enqueue(QueuedOpList);
+		}
 	}
 	else
 	{
@@ -525,6 +574,20 @@ void USpatialWorkerConnection::QueueLatestOpList()
 	}
 }
 
+void USpatialWorkerConnection::DestroyQueuedOpLists()
+{
+	FQueuedOpList QueuedOpList;
+	while (OpListQueue.IsValid() && OpListQueue->Dequeue(QueuedOpList))
+	{
+		Worker_OpList_Destroy(QueuedOpList.OpList);
+	}
+
+	while (OverflowOpLists.Dequeue(QueuedOpList))
+	{
+		Worker_OpList_Destroy(QueuedOpList.OpList);
+	}
+}
+
 void USpatialWorkerConnection::ProcessOutgoingMessages()
 {
 	while (!OutgoingMessagesQueue.IsEmpty())
@@ -61,7 +61,7 @@ void UGlobalStateManager::Init(USpatialNetDriver* InNetDriver, FTimerManager* In
 void UGlobalStateManager::ApplySingletonManagerData(const Worker_ComponentData& Data)
 {
 	Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data.schema_type);
-	SingletonNameToEntityId = GetStringToEntityMapFromSchema(ComponentObject, SpatialConstants::SINGLETON_MANAGER_SINGLETON_NAME_TO_ENTITY_ID);
+	SetSingletonNameToEntityId(GetStringToEntityMapFromSchema(ComponentObject, SpatialConstants::SINGLETON_MANAGER_SINGLETON_NAME_TO_ENTITY_ID));
 }
 
 void UGlobalStateManager::ApplyDeploymentMapData(const Worker_ComponentData& Data)
@@ -90,10 +90,41 @@ void UGlobalStateManager::ApplySingletonManagerUpdate(const Worker_ComponentUpda
 
 	if (Schema_GetObjectCount(ComponentObject, SpatialConstants::SINGLETON_MANAGER_SINGLETON_NAME_TO_ENTITY_ID) > 0)
 	{
-		SingletonNameToEntityId = GetStringToEntityMapFromSchema(ComponentObject, SpatialConstants::SINGLETON_MANAGER_SINGLETON_NAME_TO_ENTITY_ID);
+		SetSingletonNameToEntityId(GetStringToEntityMapFromSchema(ComponentObject, SpatialConstants::SINGLETON_MANAGER_SINGLETON_NAME_TO_ENTITY_ID));
 	}
 }
 
+void UGlobalStateManager::SetSingletonNameToEntityId(StringToEntityMap&& NewSingletonNameToEntityId)
+{
+	// Only entries that are new or point to a different entity need to be linked again.
+	for (const auto& Pair : NewSingletonNameToEntityId)
+	{
+		const Worker_EntityId* OldEntityId = SingletonNameToEntityId.Find(Pair.Key);
+		if (OldEntityId == nullptr || *OldEntityId != Pair.Value)
+		{
+			SingletonsToLink.Add(Pair.Key);
+		}
+	}
+
+	SingletonNameToEntityId = MoveTemp(NewSingletonNameToEntityId);
+
+	SingletonEntityIds.Reset();
+	for (const auto& Pair : SingletonNameToEntityId)
+	{
+		SingletonEntityIds.Add(Pair.Value);
+	}
+}
+
+UClass* UGlobalStateManager::GetSingletonClass(const FString& ClassPath)
+{
+	TWeakObjectPtr<UClass>& CachedClass = SingletonClasses.FindOrAdd(ClassPath);
+	if (!CachedClass.IsValid())
+	{
+		CachedClass = LoadObject<UClass>(nullptr, *ClassPath);
+	}
+	return CachedClass.Get();
+}
+
 void UGlobalStateManager::ApplyDeploymentMapUpdate(const Worker_ComponentUpdate& Update)
 {
 	Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(Update.schema_type);
@@ -224,7 +255,11 @@ void UGlobalStateManager::LinkExistingSingletonActor(const UClass* SingletonActo
 		return;
 	}
 
-	const Worker_EntityId SingletonEntityId = *SingletonEntityIdPtr;
+	LinkExistingSingletonActor(SingletonActorClass, *SingletonEntityIdPtr);
+}
+
+void UGlobalStateManager::LinkExistingSingletonActor(const UClass* SingletonActorClass, Worker_EntityId SingletonEntityId)
+{
 	if (SingletonEntityId == SpatialConstants::INVALID_ENTITY_ID)
 	{
 		// Singleton Entity hasn't been created yet
@@ -287,20 +322,30 @@ void UGlobalStateManager::LinkAllExistingSingletonActors()
 	// Early out for clients as they receive Singleton Actors via the normal Unreal replicated actor flow
 	if (!NetDriver->IsServer())
 	{
+		SingletonsToLink.Empty();
 		return;
 	}
 
-	for (const auto& Pair : SingletonNameToEntityId)
+	// Singletons whose Actors register later are linked by AddSingleton, so only entries that changed since the last call are visited.
+	for (const FString& ClassPath : SingletonsToLink)
 	{
-		UClass* SingletonActorClass = LoadObject<UClass>(nullptr, *Pair.Key);
+		const Worker_EntityId* SingletonEntityId = SingletonNameToEntityId.Find(ClassPath);
+		if (SingletonEntityId == nullptr)
+		{
+			continue;
+		}
+
+		UClass* SingletonActorClass = GetSingletonClass(ClassPath);
 		if (SingletonActorClass == nullptr)
 		{
-			UE_LOG(LogGlobalStateManager, Error, TEXT("Failed to find Singleton Actor Class: %s"), *Pair.Key);
+			UE_LOG(LogGlobalStateManager, Error, TEXT("Failed to find Singleton Actor Class: %s"), *ClassPath);
 			continue;
 		}
 
-		LinkExistingSingletonActor(SingletonActorClass);
+		LinkExistingSingletonActor(SingletonActorClass, *SingletonEntityId);
 	}
+
+	SingletonsToLink.Empty();
 }
 
 USpatialActorChannel* UGlobalStateManager::AddSingleton(AActor* SingletonActor)
@@ -380,7 +425,10 @@ void UGlobalStateManager::ExecuteInitialSingletonActorReplication()
 void UGlobalStateManager::UpdateSingletonEntityId(const FString& ClassName, const Worker_EntityId SingletonEntityId)
 {
 	Worker_EntityId& EntityId = SingletonNameToEntityId.FindOrAdd(ClassName);
+	// The singleton may have been assigned another entity before, which isn't a singleton entity anymore.
+	SingletonEntityIds.Remove(EntityId);
 	EntityId = SingletonEntityId;
+	SingletonEntityIds.Add(SingletonEntityId);
 
 	if (!NetDriver->StaticComponentView->HasAuthority(GlobalStateManagerEntityId, SpatialConstants::SINGLETON_MANAGER_COMPONENT_ID))
 	{
@@ -400,14 +448,7 @@ void UGlobalStateManager::UpdateSingletonEntityId(const FString& ClassName, cons
 
 bool UGlobalStateManager::IsSingletonEntity(Worker_EntityId EntityId) const
 {
-	for (const auto& Pair : SingletonNameToEntityId)
-	{
-		if (Pair.Value == EntityId)
-		{
-			return true;
-		}
-	}
-	return false;
+	return SingletonEntityIds.Contains(EntityId);
 }
 
 void UGlobalStateManager::SetAcceptingPlayers(bool bInAcceptingPlayers)
@@ -7,12 +7,88 @@
 #include "Interop/GlobalStateManager.h"
 #include "Interop/SpatialReceiver.h"
 #include "SpatialConstants.h"
+#include "SpatialGDKSettings.h"
 #include "Utils/SchemaUtils.h"
 
 DEFINE_LOG_CATEGORY(LogSnapshotManager);
 
 using namespace SpatialGDK;
 
+namespace
+{
+
+// Serialized fields of a component read from a snapshot.
+struct FSnapshotComponentPayload
+{
+	Worker_ComponentId ComponentId;
+	TArray<uint8> Data;
+};
+
+// The entities read from a snapshot, waiting for their entity ids to be reserved.
+// Entities of the same class tend to have identical ACLs, metadata, RPC endpoints and default valued components,
+// so with bDeduplicateSnapshotComponents each distinct payload is only stored once and shared between the entities using it.
+struct FSnapshotEntities
+{
+	TArray<FSnapshotComponentPayload> Payloads;
+	TMultiMap<uint32, int32> PayloadIndicesByHash;
+
+	// Indices into Payloads of the components of each entity.
+	TArray<TArray<int32>> Entities;
+	int32 GlobalStateManagerIndex = INDEX_NONE;
+
+	int32 AddPayload(Schema_ComponentData* Source, bool bDeduplicate)
+	{
+		FSnapshotComponentPayload Payload;
+		Payload.ComponentId = Schema_GetComponentDataComponentId(Source);
+
+		Schema_Object* Fields = Schema_GetComponentDataFields(Source);
+		Payload.Data.SetNumUninitialized(Schema_GetWriteBufferLength(Fields));
+		Schema_WriteToBuffer(Fields, Payload.Data.GetData());
+
+		uint32 Hash = 0;
+		if (bDeduplicate)
+		{
+			Hash = HashCombine(GetTypeHash(Payload.ComponentId), FCrc::MemCrc32(Payload.Data.GetData(), Payload.Data.Num()));
+
+			TArray<int32, TInlineAllocator<4>> Candidates;
+			PayloadIndicesByHash.MultiFind(Hash, Candidates);
+			for (int32 Candidate : Candidates)
+			{
+				if (Payloads[Candidate].ComponentId == Payload.ComponentId && Payloads[Candidate].Data == Payload.Data)
+				{
+					return Candidate;
+				}
+			}
+		}
+
+		const int32 Index = Payloads.Add(MoveTemp(Payload));
+		if (bDeduplicate)
+		{
+			PayloadIndicesByHash.Add(Hash, Index);
+		}
+		return Index;
+	}
+
+	// Component data for a create request, which takes ownership of it, so it has to be a separate copy for every entity.
+	Worker_ComponentData CreateComponentData(int32 PayloadIndex) const
+	{
+		const FSnapshotComponentPayload& Payload = Payloads[PayloadIndex];
+
+		Worker_ComponentData ComponentData{};
+		ComponentData.component_id = Payload.ComponentId;
+		ComponentData.schema_type = Schema_CreateComponentData(Payload.ComponentId);
+
+		Schema_Object* Fields = Schema_GetComponentDataFields(ComponentData.schema_type);
+		uint8_t* Buffer = Schema_AllocateBuffer(Fields, Payload.Data.Num());
+		FMemory::Memcpy(Buffer, Payload.Data.GetData(), Payload.Data.Num());
+		Schema_MergeFromBuffer(Fields, Buffer, Payload.Data.Num());
+
+		return ComponentData;
+	}
+};
+
+} // anonymous namespace
+
 void USnapshotManager::Init(USpatialNetDriver* InNetDriver)
 {
 	NetDriver = InNetDriver;
@@ -119,7 +195,9 @@ void USnapshotManager::LoadSnapshot(const FString& SnapshotName)
 		return;
 	}
 
-	TArray<TArray<Worker_ComponentData>> EntitiesToSpawn;
+	const bool bDeduplicate = GetDefault<USpatialGDKSettings>()->bDeduplicateSnapshotComponents;
+	TSharedRef<FSnapshotEntities> EntitiesToSpawn = MakeShared<FSnapshotEntities>();
+	int32 NumComponents = 0;
 
 	// Get all of the entities from the snapshot.
 	while (Worker_SnapshotInputStream_HasNext(Snapshot) > 0)
@@ -137,18 +215,19 @@ void USnapshotManager::LoadSnapshot(const FString& SnapshotName)
 		Error = Worker_SnapshotInputStream_GetError(Snapshot);
 		if (Error.IsEmpty())
 		{
-			TArray<Worker_ComponentData> EntityComponents;
+			TArray<int32>& EntityComponents = EntitiesToSpawn->Entities.AddDefaulted_GetRef();
+			EntityComponents.Reserve(EntityToSpawn->component_count);
 			for (uint32_t i = 0; i < EntityToSpawn->component_count; ++i)
 			{
-				// Entity component data must be deep copied so that it can be used for CreateEntityRequest.
-				Schema_ComponentData* CopySchemaData = DeepCopyComponentData(EntityToSpawn->components[i].schema_type);
-				Worker_ComponentData EntityComponentData{};
-				EntityComponentData.component_id = Schema_GetComponentDataComponentId(CopySchemaData);
-				EntityComponentData.schema_type = CopySchemaData;
-				EntityComponents.Add(EntityComponentData);
-			}
+				// The entity is only valid until the next read, so its component data is serialized to be recreated for the CreateEntityRequest.
+				EntityComponents.Add(EntitiesToSpawn->AddPayload(EntityToSpawn->components[i].schema_type, bDeduplicate));
 
-			EntitiesToSpawn.Add(EntityComponents);
+				if (EntityToSpawn->components[i].component_id == SpatialConstants::SINGLETON_MANAGER_COMPONENT_ID)
+				{
+					EntitiesToSpawn->GlobalStateManagerIndex = EntitiesToSpawn->Entities.Num() - 1;
+				}
+			}
+			NumComponents += EntityComponents.Num();
 		}
 		else
 		{
@@ -160,6 +239,17 @@ void USnapshotManager::LoadSnapshot(const FString& SnapshotName)
 
 	Worker_SnapshotInputStream_Destroy(Snapshot);
 
+	int64 PayloadBytes = 0;
+	for (const FSnapshotComponentPayload& Payload : EntitiesToSpawn->Payloads)
+	{
+		PayloadBytes += Payload.Data.Num();
+	}
+	UE_LOG(LogSnapshotManager, Log, TEXT("Read %d entities with %d components from snapshot, stored as %d distinct component payloads (%lld bytes)."),
+		EntitiesToSpawn->Entities.Num(), NumComponents, EntitiesToSpawn->Payloads.Num(), PayloadBytes);
+
+	// The hashes are only needed while reading.
+	EntitiesToSpawn->PayloadIndicesByHash.Empty();
+
 	// Set up reserve IDs delegate
 	ReserveEntityIDsDelegate SpawnEntitiesDelegate;
 	SpawnEntitiesDelegate.BindLambda([EntitiesToSpawn, this](const Worker_ReserveEntityIdsResponseOp& Op)
@@ -167,22 +257,24 @@ void USnapshotManager::LoadSnapshot(const FString& SnapshotName)
 		UE_LOG(LogSnapshotManager, Log, TEXT("Creating entities in snapshot, number of entities to spawn: %i"), Op.number_of_entity_ids);
 
 		// Ensure we have the same number of reserved IDs as we have entities to spawn
-		check(EntitiesToSpawn.Num() == Op.number_of_entity_ids);
+		check(EntitiesToSpawn->Entities.Num() == Op.number_of_entity_ids);
 
 		for (uint32_t i = 0; i < Op.number_of_entity_ids; i++)
 		{
 			// Get an entity to spawn and a reserved EntityID
-			TArray<Worker_ComponentData> EntityToSpawn = EntitiesToSpawn[i];
+			TArray<Worker_ComponentData> EntityToSpawn;
+			EntityToSpawn.Reserve(EntitiesToSpawn->Entities[i].Num());
+			for (int32 PayloadIndex : EntitiesToSpawn->Entities[i])
+			{
+				EntityToSpawn.Add(EntitiesToSpawn->CreateComponentData(PayloadIndex));
+			}
 			Worker_EntityId ReservedEntityID = Op.first_entity_id + i;
 
 			// Check if this is the GSM
-			for (auto& ComponentData : EntityToSpawn)
+			if (EntitiesToSpawn->GlobalStateManagerIndex == static_cast<int32>(i))
 			{
-				if (ComponentData.component_id == SpatialConstants::SINGLETON_MANAGER_COMPONENT_ID)
-				{
-					// Save the new GSM Entity ID.
-					GlobalStateManager->GlobalStateManagerEntityId = ReservedEntityID;
-				}
+				// Save the new GSM Entity ID.
+				GlobalStateManager->GlobalStateManagerEntityId = ReservedEntityID;
 			}
 
 			UE_LOG(LogSnapshotManager, Log, TEXT("Sending entity create request for: %i"), ReservedEntityID);
@@ -193,7 +285,7 @@ void USnapshotManager::LoadSnapshot(const FString& SnapshotName)
 	});
 
 	// Reserve the Entity IDs
-	Worker_RequestId ReserveRequestID = NetDriver->Connection->SendReserveEntityIdsRequest(EntitiesToSpawn.Num());
+	Worker_RequestId ReserveRequestID = NetDriver->Connection->SendReserveEntityIdsRequest(EntitiesToSpawn->Entities.Num());
 
 	// TODO: UNR-654
 	// References to entities that are stored within the snapshot need remapping once we know the new entity IDs.
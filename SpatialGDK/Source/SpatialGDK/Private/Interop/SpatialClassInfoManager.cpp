@@ -18,6 +18,7 @@
 #include "EngineClasses/SpatialNetDriver.h"
 #include "EngineClasses/SpatialPackageMapClient.h"
 #include "Utils/ActorGroupManager.h"
+#include "Utils/InterestFactory.h"
 #include "Utils/RepLayoutUtils.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialClassInfoManager);
@@ -37,6 +38,24 @@ bool USpatialClassInfoManager::TryInit(USpatialNetDriver* InNetDriver, UActorGro
 		return false;
 	}
 
+	for (const auto& ActorSchemaData : SchemaDatabase->ActorClassPathToSchema)
+	{
+		for (const FPropertyGroupSchemaData& PropertyGroup : ActorSchemaData.Value.PropertyGroups)
+		{
+			PropertyGroupComponentIds.FindOrAdd(PropertyGroup.Name).Add(PropertyGroup.ComponentId);
+		}
+	}
+
+	ClassIdToClassPath.SetNum(FMath::Max<int32>(SchemaDatabase->NextAvailableClassId, 1) - 1);
+	for (const auto& ClassPathToClassId : SchemaDatabase->ActorClassPathToClassId)
+	{
+		if (ClassIdToClassPath.IsValidIndex(ClassPathToClassId.Value - 1))
+		{
+			ClassIdToClassPath[ClassPathToClassId.Value - 1] = ClassPathToClassId.Key;
+		}
+	}
+	ClassIdToActorClass.SetNum(ClassIdToClassPath.Num());
+
 	return true;
 }
 
@@ -159,6 +178,7 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 	if (Class->IsChildOf<AActor>())
 	{
 		FinishConstructingActorClassInfo(ClassPath, Info);
+		SpatialGDK::OnActorClassRegistered(Class);
 	}
 	else
 	{
@@ -168,6 +188,11 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 
 void USpatialClassInfoManager::FinishConstructingActorClassInfo(const FString& ClassPath, TSharedRef<FClassInfo>& Info)
 {
+	if (const uint32* ClassId = SchemaDatabase->ActorClassPathToClassId.Find(ClassPath))
+	{
+		Info->ClassId = *ClassId;
+	}
+
 	ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
 	{
 		Worker_ComponentId ComponentId = SchemaDatabase->ActorClassPathToSchema[ClassPath].SchemaComponents[Type];
@@ -186,6 +211,24 @@ void USpatialClassInfoManager::FinishConstructingActorClassInfo(const FString& C
 		}
 	});
 
+	for (const FPropertyGroupSchemaData& PropertyGroup : SchemaDatabase->ActorClassPathToSchema[ClassPath].PropertyGroups)
+	{
+		Info->PropertyGroupComponents.Add(PropertyGroup.ComponentId);
+		ComponentToClassInfoMap.Add(PropertyGroup.ComponentId, Info);
+		ComponentToOffsetMap.Add(PropertyGroup.ComponentId, 0);
+		// Property groups hold properties split off from the data component, so they are read the same way.
+		ComponentToCategoryMap.Add(PropertyGroup.ComponentId, SCHEMA_Data);
+
+		for (uint32 Handle : PropertyGroup.Handles)
+		{
+			if (Info->HandleToPropertyGroupComponent.Num() < (int32)Handle)
+			{
+				Info->HandleToPropertyGroupComponent.SetNumZeroed(Handle);
+			}
+			Info->HandleToPropertyGroupComponent[Handle - 1] = PropertyGroup.ComponentId;
+		}
+	}
+
 	for (auto& SubobjectClassDataPair : SchemaDatabase->ActorClassPathToSchema[ClassPath].SubobjectData)
 	{
 		int32 Offset = SubobjectClassDataPair.Key;
@@ -275,6 +318,38 @@ void USpatialClassInfoManager::TryCreateClassInfoForComponentId(Worker_Component
 	}
 }
 
+UClass* USpatialClassInfoManager::GetActorClassByClassId(uint32 ClassId, bool bAllowLoad)
+{
+	const int32 Index = (int32)ClassId - 1;
+	if (!ClassIdToActorClass.IsValidIndex(Index) || ClassIdToClassPath[Index].IsEmpty())
+	{
+		UE_LOG(LogSpatialClassInfoManager, Warning, TEXT("Class id %u is not in the schema database. Try regenerating schema."), ClassId);
+		return nullptr;
+	}
+
+	if (ClassIdToActorClass[Index].IsValid())
+	{
+		return ClassIdToActorClass[Index].Get();
+	}
+
+	const FString& ClassPath = ClassIdToClassPath[Index];
+	UClass* Class = bAllowLoad ? LoadObject<UClass>(nullptr, *ClassPath) : FindObject<UClass>(nullptr, *ClassPath, false);
+	if (Class == nullptr || !Class->IsChildOf<AActor>())
+	{
+		return nullptr;
+	}
+
+	ClassIdToActorClass[Index] = Class;
+
+	return Class;
+}
+
+const FString* USpatialClassInfoManager::GetActorClassPathByClassId(uint32 ClassId) const
+{
+	const int32 Index = (int32)ClassId - 1;
+	return ClassIdToClassPath.IsValidIndex(Index) && !ClassIdToClassPath[Index].IsEmpty() ? &ClassIdToClassPath[Index] : nullptr;
+}
+
 bool USpatialClassInfoManager::IsSupportedClass(const FString& PathName) const
 {
 	return SchemaDatabase->ActorClassPathToSchema.Contains(PathName) || SchemaDatabase->SubobjectClassPathToSchema.Contains(PathName);
@@ -455,6 +530,48 @@ bool USpatialClassInfoManager::IsSublevelComponent(Worker_ComponentId ComponentI
 	return SchemaDatabase->LevelComponentIds.Contains(ComponentId);
 }
 
+TArray<Worker_ComponentId> USpatialClassInfoManager::GetComponentIdsOutsidePropertyGroups() const
+{
+	// Handover components are only read by servers, so clients never need them either.
+	TSet<Worker_ComponentId> ExcludedComponents;
+	for (const auto& PropertyGroup : PropertyGroupComponentIds)
+	{
+		ExcludedComponents.Append(PropertyGroup.Value);
+	}
+
+	for (const auto& ActorSchemaData : SchemaDatabase->ActorClassPathToSchema)
+	{
+		ExcludedComponents.Add(ActorSchemaData.Value.SchemaComponents[SCHEMA_Handover]);
+		for (const auto& SubobjectData : ActorSchemaData.Value.SubobjectData)
+		{
+			ExcludedComponents.Add(SubobjectData.Value.SchemaComponents[SCHEMA_Handover]);
+		}
+	}
+
+	for (const auto& SubobjectSchemaData : SchemaDatabase->SubobjectClassPathToSchema)
+	{
+		for (const FDynamicSubobjectSchemaData& DynamicSubobjectData : SubobjectSchemaData.Value.DynamicSubobjectComponents)
+		{
+			ExcludedComponents.Add(DynamicSubobjectData.SchemaComponents[SCHEMA_Handover]);
+		}
+	}
+
+	TArray<Worker_ComponentId> ComponentIds;
+	ComponentIds.Reserve(SchemaDatabase->ComponentIdToClassPath.Num() + SchemaDatabase->LevelComponentIds.Num());
+
+	for (const auto& ComponentIdClassPathPair : SchemaDatabase->ComponentIdToClassPath)
+	{
+		if (!ExcludedComponents.Contains(ComponentIdClassPathPair.Key))
+		{
+			ComponentIds.Add(ComponentIdClassPathPair.Key);
+		}
+	}
+
+	ComponentIds.Append(SchemaDatabase->LevelComponentIds.Array());
+
+	return ComponentIds;
+}
+
 void USpatialClassInfoManager::QuitGame()
 {
 #if WITH_EDITOR
@@ -2,10 +2,12 @@
 
 #include "Interop/SpatialReceiver.h"
 
+#include "Async/ParallelFor.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
 #include "Kismet/GameplayStatics.h"
+#include "Misc/PackageName.h"
 #include "TimerManager.h"
 
 #include "EngineClasses/SpatialActorChannel.h"
@@ -24,13 +26,17 @@
 #include "Schema/SpawnData.h"
 #include "Schema/UnrealMetadata.h"
 #include "SpatialConstants.h"
+#include "SpatialGDKSettings.h"
 #include "Utils/ComponentReader.h"
 #include "Utils/ErrorCodeRemapping.h"
+#include "Utils/RPCParameterCodec.h"
 #include "Utils/RepLayoutUtils.h"
 #include "Utils/SpatialMetrics.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialReceiver);
 
+DECLARE_CYCLE_STAT(TEXT("ParsePendingAddComponents"), STAT_SpatialReceiverParsePendingAddComponents, STATGROUP_SpatialNet);
+
 using namespace SpatialGDK;
 
 void USpatialReceiver::Init(USpatialNetDriver* InNetDriver, FTimerManager* InTimerManager)
@@ -68,13 +74,61 @@ void USpatialReceiver::LeaveCriticalSection()
 	UE_LOG(LogSpatialReceiver, Verbose, TEXT("Leaving critical section."));
 	check(bInCriticalSection);
 
+	if (!NetDriver->IsServer() && GetDefault<USpatialGDKSettings>()->bAsyncLoadNewClassesOnEntityCheckout)
+	{
+		// Hold back entities whose class isn't loaded yet, so their components aren't parsed or applied until it is.
+		// Servers load every class they need up front, so only clients pay for this check.
+		for (Worker_EntityId PendingAddEntity : PendingAddEntities)
+		{
+			UnrealMetadata* UnrealMetadataComp = StaticComponentView->GetComponentData<UnrealMetadata>(PendingAddEntity);
+			FString ClassPath;
+			if (UnrealMetadataComp != nullptr && NeedToLoadClass(UnrealMetadataComp, ClassPath))
+			{
+				StartAsyncLoadingClass(PendingAddEntity, ClassPath);
+			}
+		}
+	}
+
+	ParsePendingAddComponents();
+
+	// Create and register every Actor in this batch before applying any component data,
+	// so references between entities received together resolve directly instead of being queued as unresolved.
+	TArray<TPair<Worker_EntityId, TWeakObjectPtr<USpatialActorChannel>>> ReceivedActorChannels;
+	ReceivedActorChannels.Reserve(PendingAddEntities.Num());
+
 	for (Worker_EntityId& PendingAddEntity : PendingAddEntities)
 	{
-		ReceiveActor(PendingAddEntity);
+		if (EntitiesWaitingForAsyncLoad.Contains(PendingAddEntity))
+		{
+			continue;
+		}
+
+		if (USpatialActorChannel* Channel = ReceiveActor(PendingAddEntity))
+		{
+			ReceivedActorChannels.Emplace(PendingAddEntity, Channel);
+		}
+	}
+
+	for (const TPair<Worker_EntityId, TWeakObjectPtr<USpatialActorChannel>>& ReceivedActorChannel : ReceivedActorChannels)
+	{
+		USpatialActorChannel* Channel = ReceivedActorChannel.Value.Get();
+		if (Channel == nullptr || Channel->Actor == nullptr || Channel->Actor->IsPendingKill())
+		{
+			// Destroyed while initializing an Actor received earlier in this batch.
+			continue;
+		}
+
+		ApplyInitialActorState(ReceivedActorChannel.Key, Channel);
 	}
 
 	for (Worker_AuthorityChangeOp& PendingAuthorityChange : PendingAuthorityChanges)
 	{
+		if (FEntityWaitingForAsyncLoad* AsyncLoadEntity = EntitiesWaitingForAsyncLoad.Find(PendingAuthorityChange.entity_id))
+		{
+			AsyncLoadEntity->PendingAuthorityChanges.Add(PendingAuthorityChange);
+			continue;
+		}
+
 		HandleActorAuthority(PendingAuthorityChange);
 	}
 
@@ -85,6 +139,84 @@ void USpatialReceiver::LeaveCriticalSection()
 	PendingAuthorityChanges.Empty();
 
 	ProcessQueuedResolvedObjects();
+
+	TArray<Worker_EntityId> LoadedEntities = MoveTemp(EntitiesLoadedAsyncInCriticalSection);
+	for (Worker_EntityId EntityId : LoadedEntities)
+	{
+		ReceiveEntityLoadedAsync(EntityId);
+	}
+}
+
+void USpatialReceiver::ParsePendingAddComponents()
+{
+	SCOPE_CYCLE_COUNTER(STAT_SpatialReceiverParsePendingAddComponents);
+
+	struct FParseJob
+	{
+		PendingAddComponentWrapper* PendingAddComponent;
+		ESchemaComponentType ComponentType;
+		TSharedPtr<FRepLayout> RepLayout;
+		const FClassInfo* ClassInfo;
+	};
+
+	// Anything that may create engine or class info state has to be looked up here, on the game thread.
+	TArray<FParseJob> ParseJobs;
+	ParseJobs.Reserve(PendingAddComponents.Num());
+
+	for (PendingAddComponentWrapper& PendingAddComponent : PendingAddComponents)
+	{
+		if (ClassInfoManager->IsSublevelComponent(PendingAddComponent.ComponentId))
+		{
+			continue;
+		}
+
+		ESchemaComponentType ComponentType = ClassInfoManager->GetCategoryByComponentId(PendingAddComponent.ComponentId);
+		if (ComponentType != SCHEMA_Data && ComponentType != SCHEMA_OwnerOnly && ComponentType != SCHEMA_Handover)
+		{
+			continue;
+		}
+
+		UClass* Class = ClassInfoManager->GetClassByComponentId(PendingAddComponent.ComponentId);
+		if (Class == nullptr)
+		{
+			continue;
+		}
+
+		PendingAddComponent.ParsedData = MakeUnique<ParsedComponentData>();
+		PendingAddComponent.ParsedData->Class = Class;
+
+		FParseJob& Job = ParseJobs.AddDefaulted_GetRef();
+		Job.PendingAddComponent = &PendingAddComponent;
+		Job.ComponentType = ComponentType;
+		if (ComponentType == SCHEMA_Handover)
+		{
+			Job.ClassInfo = &ClassInfoManager->GetOrCreateClassInfoByClass(Class);
+		}
+		else
+		{
+			Job.RepLayout = NetDriver->GetObjectClassRepLayout(Class);
+		}
+	}
+
+	// Each job only reads its own component data and writes its own parsed data, so they can run concurrently.
+	ParallelFor(ParseJobs.Num(), [&ParseJobs](int32 Index)
+	{
+		FParseJob& Job = ParseJobs[Index];
+		Schema_Object* ComponentObject = Schema_GetComponentDataFields(Job.PendingAddComponent->Data->ComponentData->schema_type);
+
+		TArray<Schema_FieldId> FieldIds;
+		FieldIds.SetNumUninitialized(Schema_GetUniqueFieldIdCount(ComponentObject));
+		Schema_GetUniqueFieldIds(ComponentObject, FieldIds.GetData());
+
+		if (Job.ComponentType == SCHEMA_Handover)
+		{
+			ParseHandoverSchemaObject(ComponentObject, FieldIds, *Job.ClassInfo, *Job.PendingAddComponent->ParsedData);
+		}
+		else
+		{
+			ParseSchemaObject(ComponentObject, FieldIds, *Job.RepLayout, *Job.PendingAddComponent->ParsedData);
+		}
+	}, !GetDefault<USpatialGDKSettings>()->bParseComponentDataInParallel);
 }
 
 void USpatialReceiver::OnAddEntity(const Worker_AddEntityOp& Op)
@@ -140,7 +272,11 @@ void USpatialReceiver::OnAddComponent(const Worker_AddComponentOp& Op)
 		return;
 	}
 
-	if (bInCriticalSection)
+	if (FEntityWaitingForAsyncLoad* AsyncLoadEntity = EntitiesWaitingForAsyncLoad.Find(Op.entity_id))
+	{
+		AsyncLoadEntity->PendingAddComponents.Emplace(Op.entity_id, Op.data.component_id, MakeUnique<DynamicComponent>(Op.data));
+	}
+	else if (bInCriticalSection)
 	{
 		PendingAddComponents.Emplace(Op.entity_id, Op.data.component_id, MakeUnique<DynamicComponent>(Op.data));
 	}
@@ -152,6 +288,11 @@ void USpatialReceiver::OnAddComponent(const Worker_AddComponentOp& Op)
 
 void USpatialReceiver::OnRemoveEntity(const Worker_RemoveEntityOp& Op)
 {
+	if (EntitiesWaitingForAsyncLoad.Contains(Op.entity_id))
+	{
+		DiscardEntityWaitingForAsyncLoad(Op.entity_id);
+	}
+
 	RemoveActor(Op.entity_id);
 }
 
@@ -164,6 +305,14 @@ void USpatialReceiver::OnRemoveComponent(const Worker_RemoveComponentOp& Op)
 	// RemoveComponentOps in ProcessRemoveComponent. Any RemoveComponentOps that relate to delete entities
 	// will be dropped in ProcessRemoveComponent.
 	QueuedRemoveComponentOps.Add(Op);
+
+	if (FEntityWaitingForAsyncLoad* AsyncLoadEntity = EntitiesWaitingForAsyncLoad.Find(Op.entity_id))
+	{
+		AsyncLoadEntity->PendingAddComponents.RemoveAll([&Op](const PendingAddComponentWrapper& PendingAddComponent)
+		{
+			return PendingAddComponent.ComponentId == Op.component_id;
+		});
+	}
 }
 
 void USpatialReceiver::FlushRemoveComponentOps()
@@ -230,6 +379,12 @@ void USpatialReceiver::OnAuthorityChange(const Worker_AuthorityChangeOp& Op)
 		return;
 	}
 
+	if (FEntityWaitingForAsyncLoad* AsyncLoadEntity = EntitiesWaitingForAsyncLoad.Find(Op.entity_id))
+	{
+		AsyncLoadEntity->PendingAuthorityChanges.Add(Op);
+		return;
+	}
+
 	HandleActorAuthority(Op);
 }
 
@@ -247,8 +402,9 @@ void USpatialReceiver::HandlePlayerLifecycleAuthority(const Worker_AuthorityChan
 				if (NetDriver->IsServer())
 				{
 					AuthorityPlayerControllerConnectionMap.Add(Op.entity_id, Connection);
+					ClientHeartbeats.Add(Op.entity_id, FPlatformTime::Seconds());
 				}
-				Connection->InitHeartbeat(TimerManager, Op.entity_id);
+				Connection->InitHeartbeat(Op.entity_id);
 			}
 		}
 		else if (Op.authority == WORKER_AUTHORITY_NOT_AUTHORITATIVE)
@@ -256,6 +412,7 @@ void USpatialReceiver::HandlePlayerLifecycleAuthority(const Worker_AuthorityChan
 			if (NetDriver->IsServer())
 			{
 				AuthorityPlayerControllerConnectionMap.Remove(Op.entity_id);
+				ClientHeartbeats.Remove(Op.entity_id);
 			}
 			if (USpatialNetConnection* Connection = Cast<USpatialNetConnection>(PlayerController->GetNetConnection()))
 			{
@@ -287,12 +444,15 @@ void USpatialReceiver::HandleActorAuthority(const Worker_AuthorityChangeOp& Op)
 		check(!NetDriver->IsServer());
 		if (RPCsOnEntityCreation* QueuedRPCs = StaticComponentView->GetComponentData<RPCsOnEntityCreation>(Op.entity_id))
 		{
-			if (QueuedRPCs->HasRPCPayloadData())
+			// RPCs this or a previous owning client already acknowledged are skipped. The acknowledgement for the rest
+			// is sent with the endpoint ready update below.
+			const ClientRPCEndpoint* Endpoint = StaticComponentView->GetComponentData<ClientRPCEndpoint>(Op.entity_id);
+			const uint32 AckedRPCs = Endpoint != nullptr ? Endpoint->AckedRPCsOnEntityCreation : 0;
+
+			if (QueuedRPCs->HasRPCPayloadData() && (uint32)QueuedRPCs->RPCs.Num() > AckedRPCs)
 			{
-				ProcessQueuedActorRPCsOnEntityCreation(Actor, *QueuedRPCs);
+				ProcessQueuedActorRPCsOnEntityCreation(Actor, *QueuedRPCs, AckedRPCs);
 			}
-
-			Sender->SendRequestToClearRPCsOnEntityCreation(Op.entity_id);
 		}
 	}
 
@@ -446,7 +606,162 @@ bool USpatialReceiver::IsReceivedEntityTornOff(Worker_EntityId EntityId)
 	return false;
 }
 
-void USpatialReceiver::ReceiveActor(Worker_EntityId EntityId)
+bool USpatialReceiver::NeedToLoadClass(UnrealMetadata* UnrealMetadataComp, FString& OutClassPath)
+{
+	// Stably named Actors are never spawned from their class, they are found once their level has loaded.
+	if (UnrealMetadataComp->StablyNamedRef.IsSet())
+	{
+		return false;
+	}
+
+	if (UnrealMetadataComp->ClassId.IsSet())
+	{
+		// Classes that were resolved before are found in the class id table without any path lookups.
+		if (ClassInfoManager->GetActorClassByClassId(UnrealMetadataComp->ClassId.GetValue(), /* bAllowLoad */ false) != nullptr)
+		{
+			return false;
+		}
+
+		const FString* ClassPath = ClassInfoManager->GetActorClassPathByClassId(UnrealMetadataComp->ClassId.GetValue());
+		if (ClassPath == nullptr)
+		{
+			return false;
+		}
+		OutClassPath = *ClassPath;
+	}
+	else
+	{
+		OutClassPath = UnrealMetadataComp->ClassPath;
+		if (OutClassPath.IsEmpty() || FindObject<UClass>(nullptr, *OutClassPath, false) != nullptr)
+		{
+			return false;
+		}
+	}
+
+	// If the package is loaded but the class can't be found, let the synchronous path report it.
+	return FindPackage(nullptr, *FPackageName::ObjectPathToPackageName(OutClassPath)) == nullptr;
+}
+
+void USpatialReceiver::StartAsyncLoadingClass(Worker_EntityId EntityId, const FString& ClassPath)
+{
+	const FName PackageName(*FPackageName::ObjectPathToPackageName(ClassPath));
+
+	FEntityWaitingForAsyncLoad& AsyncLoadEntity = EntitiesWaitingForAsyncLoad.Add(EntityId);
+	AsyncLoadEntity.PackageName = PackageName;
+
+	for (PendingAddComponentWrapper& PendingAddComponent : PendingAddComponents)
+	{
+		if (PendingAddComponent.EntityId == EntityId)
+		{
+			AsyncLoadEntity.PendingAddComponents.Add(MoveTemp(PendingAddComponent));
+		}
+	}
+
+	PendingAddComponents.RemoveAll([EntityId](const PendingAddComponentWrapper& PendingAddComponent)
+	{
+		return PendingAddComponent.EntityId == EntityId;
+	});
+
+	// Several entities of the same class can be waiting on a single load.
+	if (TArray<Worker_EntityId>* WaitingEntities = AsyncLoadingPackages.Find(PackageName))
+	{
+		WaitingEntities->Add(EntityId);
+		return;
+	}
+
+	UE_LOG(LogSpatialReceiver, Log, TEXT("Loading package %s asynchronously, entity %lld will be spawned once it has loaded."), *PackageName.ToString(), EntityId);
+
+	AsyncLoadingPackages.Add(PackageName).Add(EntityId);
+	LoadPackageAsync(PackageName.ToString(), FLoadPackageAsyncDelegate::CreateUObject(this, &USpatialReceiver::OnAsyncPackageLoaded));
+}
+
+void USpatialReceiver::OnAsyncPackageLoaded(const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result)
+{
+	TArray<Worker_EntityId> WaitingEntities;
+	if (!AsyncLoadingPackages.RemoveAndCopyValue(PackageName, WaitingEntities))
+	{
+		return;
+	}
+
+	if (Result != EAsyncLoadingResult::Succeeded)
+	{
+		UE_LOG(LogSpatialReceiver, Error, TEXT("Failed to load package %s asynchronously. %d entities depending on it will not be spawned."), *PackageName.ToString(), WaitingEntities.Num());
+
+		for (Worker_EntityId EntityId : WaitingEntities)
+		{
+			DiscardEntityWaitingForAsyncLoad(EntityId);
+		}
+		return;
+	}
+
+	for (Worker_EntityId EntityId : WaitingEntities)
+	{
+		// Synchronous loads flush async loading, so this can be called while processing ops.
+		if (bInCriticalSection)
+		{
+			EntitiesLoadedAsyncInCriticalSection.Add(EntityId);
+		}
+		else
+		{
+			ReceiveEntityLoadedAsync(EntityId);
+		}
+	}
+}
+
+void USpatialReceiver::ReceiveEntityLoadedAsync(Worker_EntityId EntityId)
+{
+	FEntityWaitingForAsyncLoad* AsyncLoadEntity = EntitiesWaitingForAsyncLoad.Find(EntityId);
+	if (AsyncLoadEntity == nullptr)
+	{
+		// The entity left our view while its class was loading.
+		return;
+	}
+
+	FEntityWaitingForAsyncLoad LoadedEntity = MoveTemp(*AsyncLoadEntity);
+	EntitiesWaitingForAsyncLoad.Remove(EntityId);
+
+	// Replay the initial ops of the entity as if it was received in a critical section just now.
+	// Loads only complete outside of critical sections, so no other entity's ops are pending here.
+	check(!bInCriticalSection);
+	EnterCriticalSection();
+	PendingAddEntities.Add(EntityId);
+	PendingAddComponents.Append(MoveTemp(LoadedEntity.PendingAddComponents));
+	PendingAuthorityChanges.Append(MoveTemp(LoadedEntity.PendingAuthorityChanges));
+	LeaveCriticalSection();
+
+	for (Worker_ComponentUpdate* ComponentUpdate : LoadedEntity.PendingComponentUpdates)
+	{
+		Worker_ComponentUpdateOp Op{};
+		Op.entity_id = EntityId;
+		Op.update = *ComponentUpdate;
+		OnComponentUpdate(Op);
+
+		Worker_ReleaseComponentUpdate(ComponentUpdate);
+	}
+}
+
+void USpatialReceiver::DiscardEntityWaitingForAsyncLoad(Worker_EntityId EntityId)
+{
+	FEntityWaitingForAsyncLoad AsyncLoadEntity;
+	if (FEntityWaitingForAsyncLoad* Found = EntitiesWaitingForAsyncLoad.Find(EntityId))
+	{
+		AsyncLoadEntity = MoveTemp(*Found);
+		EntitiesWaitingForAsyncLoad.Remove(EntityId);
+	}
+
+	for (Worker_ComponentUpdate* ComponentUpdate : AsyncLoadEntity.PendingComponentUpdates)
+	{
+		Worker_ReleaseComponentUpdate(ComponentUpdate);
+	}
+
+	// The package keeps loading for any other entities waiting on it, this entity is skipped once it finishes.
+	if (TArray<Worker_EntityId>* WaitingEntities = AsyncLoadingPackages.Find(AsyncLoadEntity.PackageName))
+	{
+		WaitingEntities->Remove(EntityId);
+	}
+}
+
+USpatialActorChannel* USpatialReceiver::ReceiveActor(Worker_EntityId EntityId)
 {
 	checkf(NetDriver, TEXT("We should have a NetDriver whilst processing ops."));
 	checkf(NetDriver->GetWorld(), TEXT("We should have a World whilst processing ops."));
@@ -457,7 +772,7 @@ void USpatialReceiver::ReceiveActor(Worker_EntityId EntityId)
 	if (UnrealMetadataComp == nullptr)
 	{
 		// Not an Unreal entity
-		return;
+		return nullptr;
 	}
 
 	if (AActor* EntityActor = Cast<AActor>(PackageMap->GetObjectFromEntityId(EntityId)))
@@ -480,125 +795,132 @@ void USpatialReceiver::ReceiveActor(Worker_EntityId EntityId)
 		// If we're a singleton, apply the data, regardless of authority - JIRA: 736
 
 		UE_LOG(LogSpatialReceiver, Log, TEXT("Received create entity response op for %lld"), EntityId);
+
+		return nullptr;
 	}
-	else
+
+	UClass* Class = UnrealMetadataComp->GetNativeEntityClass(ClassInfoManager);
+	if (Class == nullptr)
 	{
-		UClass* Class = UnrealMetadataComp->GetNativeEntityClass();
-		if (Class == nullptr)
-		{
-			UE_LOG(LogSpatialReceiver, Warning, TEXT("The received actor with entity id %lld couldn't be loaded. The actor (%s) will not be spawned."),
-				EntityId, *UnrealMetadataComp->ClassPath);
-			return;
-		}
+		UE_LOG(LogSpatialReceiver, Warning, TEXT("The received actor with entity id %lld couldn't be loaded. The actor (%s) will not be spawned."),
+			EntityId, *UnrealMetadataComp->GetClassDescription());
+		return nullptr;
+	}
 
-		// Make sure ClassInfo exists
-		ClassInfoManager->GetOrCreateClassInfoByClass(Class);
+	// Make sure ClassInfo exists
+	ClassInfoManager->GetOrCreateClassInfoByClass(Class);
 
-		// If the received actor is torn off, don't bother spawning it.
-		// (This is only needed due to the delay between tearoff and deleting the entity. See https://improbableio.atlassian.net/browse/UNR-841)
-		if (IsReceivedEntityTornOff(EntityId))
-		{
-			UE_LOG(LogSpatialReceiver, Verbose, TEXT("The received actor with entity id %lld was already torn off. The actor will not be spawned."), EntityId);
-			return;
-		}
+	// If the received actor is torn off, don't bother spawning it.
+	// (This is only needed due to the delay between tearoff and deleting the entity. See https://improbableio.atlassian.net/browse/UNR-841)
+	if (IsReceivedEntityTornOff(EntityId))
+	{
+		UE_LOG(LogSpatialReceiver, Verbose, TEXT("The received actor with entity id %lld was already torn off. The actor will not be spawned."), EntityId);
+		return nullptr;
+	}
 
-		EntityActor = TryGetOrCreateActor(UnrealMetadataComp, SpawnDataComp);
+	AActor* EntityActor = TryGetOrCreateActor(UnrealMetadataComp, SpawnDataComp);
 
-		if (EntityActor == nullptr)
-		{
-			// This could be nullptr if:
-			// a stably named actor could not be found
-			// the Actor is a singleton that has arrived over the wire before it has been created on this worker
-			// the class couldn't be loaded
-			return;
-		}
+	if (EntityActor == nullptr)
+	{
+		// This could be nullptr if:
+		// a stably named actor could not be found
+		// the Actor is a singleton that has arrived over the wire before it has been created on this worker
+		// the class couldn't be loaded
+		return nullptr;
+	}
 
-		UNetConnection* Connection = NetDriver->GetSpatialOSNetConnection();
+	UNetConnection* Connection = NetDriver->GetSpatialOSNetConnection();
 
-		if (NetDriver->IsServer())
+	if (NetDriver->IsServer())
+	{
+		if (APlayerController* PlayerController = Cast<APlayerController>(EntityActor))
 		{
-			if (APlayerController* PlayerController = Cast<APlayerController>(EntityActor))
-			{
-				// If entity is a PlayerController, create channel on the PlayerController's connection.
-				Connection = PlayerController->NetConnection;
-			}
+			// If entity is a PlayerController, create channel on the PlayerController's connection.
+			Connection = PlayerController->NetConnection;
 		}
+	}
 
-		if (Connection == nullptr)
-		{
-			UE_LOG(LogSpatialReceiver, Error, TEXT("Unable to find SpatialOSNetConnection! Has this worker been disconnected from SpatialOS due to a timeout?"));
-			return;
-		}
+	if (Connection == nullptr)
+	{
+		UE_LOG(LogSpatialReceiver, Error, TEXT("Unable to find SpatialOSNetConnection! Has this worker been disconnected from SpatialOS due to a timeout?"));
+		return nullptr;
+	}
 
-		// Set up actor channel.
+	// Set up actor channel.
 #if ENGINE_MINOR_VERSION <= 20
-		USpatialActorChannel* Channel = Cast<USpatialActorChannel>(Connection->CreateChannel(CHTYPE_Actor, NetDriver->IsServer()));
+	USpatialActorChannel* Channel = Cast<USpatialActorChannel>(Connection->CreateChannel(CHTYPE_Actor, NetDriver->IsServer()));
 #else
-		USpatialActorChannel* Channel = Cast<USpatialActorChannel>(Connection->CreateChannelByName(NAME_Actor, NetDriver->IsServer() ? EChannelCreateFlags::OpenedLocally : EChannelCreateFlags::None));
+	USpatialActorChannel* Channel = Cast<USpatialActorChannel>(Connection->CreateChannelByName(NAME_Actor, NetDriver->IsServer() ? EChannelCreateFlags::OpenedLocally : EChannelCreateFlags::None));
 #endif
 
-		if (!Channel)
-		{
-			UE_LOG(LogSpatialReceiver, Warning, TEXT("Failed to create an actor channel when receiving entity %lld. The actor will not be spawned."), EntityId);
-			EntityActor->Destroy(true);
-			return;
-		}
+	if (!Channel)
+	{
+		UE_LOG(LogSpatialReceiver, Warning, TEXT("Failed to create an actor channel when receiving entity %lld. The actor will not be spawned."), EntityId);
+		EntityActor->Destroy(true);
+		return nullptr;
+	}
 
-		PackageMap->ResolveEntityActor(EntityActor, EntityId);
+	PackageMap->ResolveEntityActor(EntityActor, EntityId);
 
-		Channel->SetChannelActor(EntityActor);
+	Channel->SetChannelActor(EntityActor);
 
-		// Apply initial replicated properties.
-		// This was moved to after FinishingSpawning because components existing only in blueprints aren't added until spawning is complete
-		// Potentially we could split out the initial actor state and the initial component state
-		for (PendingAddComponentWrapper& PendingAddComponent : PendingAddComponents)
-		{
-			if (ClassInfoManager->IsSublevelComponent(PendingAddComponent.ComponentId))
-			{
-				continue;
-			}
+	return Channel;
+}
 
-			if (PendingAddComponent.EntityId == EntityId)
-			{
-				ApplyComponentDataOnActorCreation(EntityId, *PendingAddComponent.Data->ComponentData, Channel);
-			}
-		}
+void USpatialReceiver::ApplyInitialActorState(Worker_EntityId EntityId, USpatialActorChannel* Channel)
+{
+	AActor* EntityActor = Channel->Actor;
 
-		if (!NetDriver->IsServer())
+	// Apply initial replicated properties.
+	// This was moved to after FinishingSpawning because components existing only in blueprints aren't added until spawning is complete
+	// Potentially we could split out the initial actor state and the initial component state
+	for (PendingAddComponentWrapper& PendingAddComponent : PendingAddComponents)
+	{
+		if (ClassInfoManager->IsSublevelComponent(PendingAddComponent.ComponentId))
 		{
-			// Update interest on the entity's components after receiving initial component data (so Role and RemoteRole are properly set).
-			Sender->SendComponentInterestForActor(Channel, EntityId, Channel->IsOwnedByWorker());
-
-			// This is a bit of a hack unfortunately, among the core classes only PlayerController implements this function and it requires
-			// a player index. For now we don't support split screen, so the number is always 0.
-			if (EntityActor->IsA(APlayerController::StaticClass()))
-			{
-				uint8 PlayerIndex = 0;
-				// FInBunch takes size in bits not bytes
-				FInBunch Bunch(NetDriver->ServerConnection, &PlayerIndex, sizeof(PlayerIndex) * 8);
-				EntityActor->OnActorChannelOpen(Bunch, NetDriver->ServerConnection);
-			}
-			else
-			{
-				FInBunch Bunch(NetDriver->ServerConnection);
-				EntityActor->OnActorChannelOpen(Bunch, NetDriver->ServerConnection);
-			}
-
+			continue;
 		}
 
-		// Taken from PostNetInit
-		if (NetDriver->GetWorld()->HasBegunPlay() && !EntityActor->HasActorBegunPlay())
+		if (PendingAddComponent.EntityId == EntityId)
 		{
-			EntityActor->DispatchBeginPlay();
+			ApplyComponentDataOnActorCreation(EntityId, *PendingAddComponent.Data->ComponentData, Channel, PendingAddComponent.ParsedData.Get());
 		}
+	}
+
+	if (!NetDriver->IsServer())
+	{
+		// Update interest on the entity's components after receiving initial component data (so Role and RemoteRole are properly set).
+		Sender->SendComponentInterestForActor(Channel, EntityId, Channel->IsOwnedByWorker());
 
-		if (EntityActor->GetClass()->HasAnySpatialClassFlags(SPATIALCLASS_Singleton))
+		// This is a bit of a hack unfortunately, among the core classes only PlayerController implements this function and it requires
+		// a player index. For now we don't support split screen, so the number is always 0.
+		if (EntityActor->IsA(APlayerController::StaticClass()))
+		{
+			uint8 PlayerIndex = 0;
+			// FInBunch takes size in bits not bytes
+			FInBunch Bunch(NetDriver->ServerConnection, &PlayerIndex, sizeof(PlayerIndex) * 8);
+			EntityActor->OnActorChannelOpen(Bunch, NetDriver->ServerConnection);
+		}
+		else
 		{
-			GlobalStateManager->RegisterSingletonChannel(EntityActor, Channel);
+			FInBunch Bunch(NetDriver->ServerConnection);
+			EntityActor->OnActorChannelOpen(Bunch, NetDriver->ServerConnection);
 		}
 
-		EntityActor->UpdateOverlaps();
 	}
+
+	// Taken from PostNetInit
+	if (NetDriver->GetWorld()->HasBegunPlay() && !EntityActor->HasActorBegunPlay())
+	{
+		EntityActor->DispatchBeginPlay();
+	}
+
+	if (EntityActor->GetClass()->HasAnySpatialClassFlags(SPATIALCLASS_Singleton))
+	{
+		GlobalStateManager->RegisterSingletonChannel(EntityActor, Channel);
+	}
+
+	EntityActor->UpdateOverlaps();
 }
 
 void USpatialReceiver::RemoveActor(Worker_EntityId EntityId)
@@ -751,8 +1073,19 @@ void USpatialReceiver::DestroyActor(AActor* Actor, Worker_EntityId EntityId)
 	// TODO: fix this with working sets (UNR-411)
 	NetDriver->StartIgnoringAuthoritativeDestruction();
 
-	// Clean up the actor channel. For clients, this will also call destroy on the actor.
-	if (USpatialActorChannel* ActorChannel = NetDriver->GetActorChannelByEntityId(EntityId))
+	USpatialActorChannel* ActorChannel = NetDriver->GetActorChannelByEntityId(EntityId);
+
+	// Clients return Actors of pooled classes to the pool instead of destroying them. The channel cleans up the package map,
+	// and dynamic subobjects would be left behind on the Actor, so Actors without a channel or with dynamic subobjects are destroyed as usual.
+	const bool bRecycleActor = Actor != nullptr && !NetDriver->IsServer() && !Actor->IsPendingKill() && ActorChannel != nullptr
+		&& ActorChannel->CreateSubObjects.Num() == 0 && ActorPool.CanRelease(Actor);
+	if (bRecycleActor)
+	{
+		RecyclingActor = Actor;
+	}
+
+	// Clean up the actor channel. For clients, this will also call destroy on the actor unless it is being recycled.
+	if (ActorChannel != nullptr)
 	{
 
 #if ENGINE_MINOR_VERSION <= 20
@@ -773,8 +1106,13 @@ void USpatialReceiver::DestroyActor(AActor* Actor, Worker_EntityId EntityId)
 		}
 	}
 
+	if (bRecycleActor)
+	{
+		RecyclingActor = nullptr;
+		ActorPool.Release(Actor);
+	}
 	// It is safe to call AActor::Destroy even if the destruction has already started.
-	if (Actor != nullptr && !Actor->Destroy(true))
+	else if (Actor != nullptr && !Actor->Destroy(true))
 	{
 		UE_LOG(LogSpatialReceiver, Error, TEXT("Failed to destroy actor in RemoveActor %s %lld"), *Actor->GetName(), EntityId);
 	}
@@ -814,11 +1152,11 @@ AActor* USpatialReceiver::TryGetOrCreateActor(UnrealMetadata* UnrealMetadataComp
 // This function is only called for client and server workers who did not spawn the Actor
 AActor* USpatialReceiver::CreateActor(UnrealMetadata* UnrealMetadataComp, SpawnData* SpawnDataComp)
 {
-	UClass* ActorClass = UnrealMetadataComp->GetNativeEntityClass();
+	UClass* ActorClass = UnrealMetadataComp->GetNativeEntityClass(ClassInfoManager);
 
 	if (ActorClass == nullptr)
 	{
-		UE_LOG(LogSpatialReceiver, Error, TEXT("Could not load class %s when spawning entity!"), *UnrealMetadataComp->ClassPath);
+		UE_LOG(LogSpatialReceiver, Error, TEXT("Could not load class %s when spawning entity!"), *UnrealMetadataComp->GetClassDescription());
 		return nullptr;
 	}
 
@@ -843,17 +1181,26 @@ AActor* USpatialReceiver::CreateActor(UnrealMetadata* UnrealMetadataComp, SpawnD
 		return Connection->PlayerController;
 	}
 
-	UE_LOG(LogSpatialReceiver, Verbose, TEXT("Spawning a %s whilst checking out an entity."), *ActorClass->GetFullName());
+	FVector SpawnLocation = FRepMovement::RebaseOntoLocalOrigin(SpawnDataComp->Location, NetDriver->GetWorld()->OriginLocation);
+	FTransform SpawnTransform(SpawnDataComp->Rotation, SpawnLocation);
 
-	FActorSpawnParameters SpawnInfo;
-	SpawnInfo.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-	SpawnInfo.bRemoteOwned = true;
-	SpawnInfo.bNoFail = true;
+	AActor* NewActor = NetDriver->IsServer() ? nullptr : ActorPool.Acquire(ActorClass, SpawnTransform);
+	if (NewActor != nullptr)
+	{
+		UE_LOG(LogSpatialReceiver, Verbose, TEXT("Reusing pooled %s whilst checking out an entity."), *NewActor->GetName());
+	}
+	else
+	{
+		UE_LOG(LogSpatialReceiver, Verbose, TEXT("Spawning a %s whilst checking out an entity."), *ActorClass->GetFullName());
 
-	FVector SpawnLocation = FRepMovement::RebaseOntoLocalOrigin(SpawnDataComp->Location, NetDriver->GetWorld()->OriginLocation);
+		FActorSpawnParameters SpawnInfo;
+		SpawnInfo.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		SpawnInfo.bRemoteOwned = true;
+		SpawnInfo.bNoFail = true;
 
-	AActor* NewActor = NetDriver->GetWorld()->SpawnActorAbsolute(ActorClass, FTransform(SpawnDataComp->Rotation, SpawnLocation), SpawnInfo);
-	check(NewActor);
+		NewActor = NetDriver->GetWorld()->SpawnActorAbsolute(ActorClass, SpawnTransform, SpawnInfo);
+		check(NewActor);
+	}
 
 	// Imitate the behavior in UPackageMapClient::SerializeNewActor.
 	const float Epsilon = 0.001f;
@@ -888,7 +1235,7 @@ FTransform USpatialReceiver::GetRelativeSpawnTransform(UClass* ActorClass, FTran
 	return NewTransform;
 }
 
-void USpatialReceiver::ApplyComponentDataOnActorCreation(Worker_EntityId EntityId, const Worker_ComponentData& Data, USpatialActorChannel* Channel)
+void USpatialReceiver::ApplyComponentDataOnActorCreation(Worker_EntityId EntityId, const Worker_ComponentData& Data, USpatialActorChannel* Channel, ParsedComponentData* ParsedData /* = nullptr */)
 {
 	uint32 Offset = 0;
 	bool bFoundOffset = ClassInfoManager->GetOffsetByComponentId(Data.component_id, Offset);
@@ -911,7 +1258,7 @@ void USpatialReceiver::ApplyComponentDataOnActorCreation(Worker_EntityId EntityI
 		Channel->CreateSubObjects.Add(TargetObject.Get());
 	}
 
-	ApplyComponentData(TargetObject.Get(), Channel, Data);
+	ApplyComponentData(TargetObject.Get(), Channel, Data, ParsedData);
 }
 
 void USpatialReceiver::HandleIndividualAddComponent(const Worker_AddComponentOp& Op)
@@ -1008,7 +1355,7 @@ void USpatialReceiver::AttachDynamicSubobject(Worker_EntityId EntityId, const FC
 	}
 }
 
-void USpatialReceiver::ApplyComponentData(UObject* TargetObject, USpatialActorChannel* Channel, const Worker_ComponentData& Data)
+void USpatialReceiver::ApplyComponentData(UObject* TargetObject, USpatialActorChannel* Channel, const Worker_ComponentData& Data, ParsedComponentData* ParsedData /* = nullptr */)
 {
 	UClass* Class = ClassInfoManager->GetClassByComponentId(Data.component_id);
 	checkf(Class, TEXT("Component %d isn't hand-written and not present in ComponentToClassMap."), Data.component_id);
@@ -1033,7 +1380,14 @@ void USpatialReceiver::ApplyComponentData(UObject* TargetObject, USpatialActorCh
 		TSet<FUnrealObjectRef> UnresolvedRefs;
 
 		ComponentReader Reader(NetDriver, ObjectReferencesMap, UnresolvedRefs);
-		Reader.ApplyComponentData(Data, TargetObject, Channel, /* bIsHandover */ false);
+		if (ParsedData != nullptr && ParsedData->Class == TargetObject->GetClass())
+		{
+			Reader.ApplyParsedComponentData(*ParsedData, TargetObject, Channel, /* bIsHandover */ false);
+		}
+		else
+		{
+			Reader.ApplyComponentData(Data, TargetObject, Channel, /* bIsHandover */ false);
+		}
 
 		QueueIncomingRepUpdates(ChannelObjectPair, ObjectReferencesMap, UnresolvedRefs);
 	}
@@ -1043,7 +1397,14 @@ void USpatialReceiver::ApplyComponentData(UObject* TargetObject, USpatialActorCh
 		TSet<FUnrealObjectRef> UnresolvedRefs;
 
 		ComponentReader Reader(NetDriver, ObjectReferencesMap, UnresolvedRefs);
-		Reader.ApplyComponentData(Data, TargetObject, Channel, /* bIsHandover */ true);
+		if (ParsedData != nullptr && ParsedData->Class == TargetObject->GetClass())
+		{
+			Reader.ApplyParsedComponentData(*ParsedData, TargetObject, Channel, /* bIsHandover */ true);
+		}
+		else
+		{
+			Reader.ApplyComponentData(Data, TargetObject, Channel, /* bIsHandover */ true);
+		}
 
 		QueueIncomingRepUpdates(ChannelObjectPair, ObjectReferencesMap, UnresolvedRefs);
 	}
@@ -1061,6 +1422,12 @@ void USpatialReceiver::OnComponentUpdate(const Worker_ComponentUpdateOp& Op)
 		return;
 	}
 
+	if (FEntityWaitingForAsyncLoad* AsyncLoadEntity = EntitiesWaitingForAsyncLoad.Find(Op.entity_id))
+	{
+		AsyncLoadEntity->PendingComponentUpdates.Add(Worker_AcquireComponentUpdate(&Op.update));
+		return;
+	}
+
 	switch (Op.update.component_id)
 	{
 	case SpatialConstants::ENTITY_ACL_COMPONENT_ID:
@@ -1097,6 +1464,14 @@ void USpatialReceiver::OnComponentUpdate(const Worker_ComponentUpdateOp& Op)
 		NetDriver->GlobalStateManager->ApplyStartupActorManagerUpdate(Op.update);
 		return;
 	case SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID:
+		if (NetDriver->IsServer())
+		{
+			// Anything a client sends on its PlayerController's endpoint shows it is still connected.
+			ClientHeartbeats.OnHeartbeat(Op.entity_id, FPlatformTime::Seconds());
+		}
+		ClearAcknowledgedRPCsOnEntityCreation(Op);
+		HandleRPC(Op);
+		return;
 	case SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID:
 	case SpatialConstants::NETMULTICAST_RPCS_COMPONENT_ID:
 		HandleRPC(Op);
@@ -1194,6 +1569,13 @@ void USpatialReceiver::HandleRPC(const Worker_ComponentUpdateOp& Op)
 
 void USpatialReceiver::ProcessRPCEventField(Worker_EntityId EntityId, const Worker_ComponentUpdateOp& Op, Worker_ComponentId RPCEndpointComponentId, bool bPacked)
 {
+	const bool bIsMulticast = Op.update.component_id == SpatialConstants::NETMULTICAST_RPCS_COMPONENT_ID;
+	if (bIsMulticast && bPacked)
+	{
+		// Multicast RPCs are never packed, and the multicast endpoint uses the packed event ID for its batch event.
+		return;
+	}
+
 	Schema_Object* EventsObject = Schema_GetComponentUpdateEvents(Op.update.schema_type);
 	const Schema_FieldId EventId = bPacked ? SpatialConstants::UNREAL_RPC_ENDPOINT_PACKED_EVENT_ID : SpatialConstants::UNREAL_RPC_ENDPOINT_EVENT_ID;
 	uint32 EventCount = Schema_GetObjectCount(EventsObject, EventId);
@@ -1210,40 +1592,75 @@ void USpatialReceiver::ProcessRPCEventField(Worker_EntityId EntityId, const Work
 		{
 			// When packing unreliable RPCs into one update, they also always go through the PlayerController.
 			// This means we need to retrieve the actual target Entity ID from the payload.
-			if (Op.update.component_id == SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID ||
-				Op.update.component_id == SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID)
-			{
-				ObjectRef.Entity = Schema_GetEntityId(EventData, SpatialConstants::UNREAL_PACKED_RPC_PAYLOAD_ENTITY_ID);
+			ObjectRef.Entity = Schema_GetEntityId(EventData, SpatialConstants::UNREAL_PACKED_RPC_PAYLOAD_ENTITY_ID);
+		}
 
+		ProcessRPCEvent(Op, RPCEndpointComponentId, ObjectRef, MoveTemp(Payload), bPacked);
+	}
 
-				// In a zoned multiworker scenario we might not have gained authority over the current entity in this bundle in time
-				// before processing so don't ApplyRPCs to an entity that we don't have authority over.
-				if (StaticComponentView->GetAuthority(ObjectRef.Entity, RPCEndpointComponentId) != WORKER_AUTHORITY_AUTHORITATIVE)
-				{
-					continue;
-				}
-			}
-		}
+	// Batched RPCs are decoded in the order they were sent, after any RPCs sent as separate events.
+	const Schema_FieldId BatchEventId = bIsMulticast ? SpatialConstants::UNREAL_MULTICAST_RPC_ENDPOINT_BATCH_EVENT_ID
+		: bPacked ? SpatialConstants::UNREAL_RPC_ENDPOINT_PACKED_BATCH_EVENT_ID : SpatialConstants::UNREAL_RPC_ENDPOINT_BATCH_EVENT_ID;
 
-		FPendingRPCParamsPtr Params = MakeUnique<FPendingRPCParams>(ObjectRef, MoveTemp(Payload));
-		if (UObject* TargetObject = PackageMap->GetObjectFromUnrealObjectRef(ObjectRef).Get())
+	uint32 BatchCount = Schema_GetObjectCount(EventsObject, BatchEventId);
+
+	for (uint32 i = 0; i < BatchCount; i++)
+	{
+		Schema_Object* EventData = Schema_IndexObject(EventsObject, BatchEventId, i);
+		TArray<uint8> Batch = GetBytesFromSchema(EventData, SpatialConstants::UNREAL_RPC_BATCH_RPCS_ID);
+
+		int32 Position = 0;
+		while (Position < Batch.Num())
 		{
-			const FClassInfo& ClassInfo = ClassInfoManager->GetOrCreateClassInfoByObject(TargetObject);
-			UFunction* Function = ClassInfo.RPCs[Payload.Index];
-			const FRPCInfo& RPCInfo = ClassInfoManager->GetRPCInfo(TargetObject, Function);
+			uint32 Offset = 0;
+			uint32 Index = 0;
+			TArray<uint8> PayloadData;
+			Worker_EntityId TargetEntityId = EntityId;
 
-			if (!IncomingRPCs.ObjectHasRPCsQueuedOfType(ObjectRef.Entity, RPCInfo.Type))
+			if (!RPCPayload::ReadFromBatch(Batch, Position, Offset, Index, PayloadData, TargetEntityId))
 			{
-				// Apply if possible, queue otherwise
-				if (ApplyRPC(*Params))
-				{
-					continue;
-				}
+				UE_LOG(LogSpatialReceiver, Error, TEXT("Malformed RPC batch received on entity %lld, component %d. Dropping the rest of the batch."), EntityId, Op.update.component_id);
+				break;
 			}
+
+			if (!bPacked)
+			{
+				TargetEntityId = EntityId;
+			}
+
+			ProcessRPCEvent(Op, RPCEndpointComponentId, FUnrealObjectRef(TargetEntityId, Offset), RPCPayload(Offset, Index, MoveTemp(PayloadData)), bPacked);
 		}
+	}
+}
+
+void USpatialReceiver::ProcessRPCEvent(const Worker_ComponentUpdateOp& Op, Worker_ComponentId RPCEndpointComponentId, const FUnrealObjectRef& ObjectRef, RPCPayload&& Payload, bool bPacked)
+{
+	// In a zoned multiworker scenario we might not have gained authority over the target entity of a packed RPC in this bundle in time
+	// before processing so don't ApplyRPCs to an entity that we don't have authority over.
+	if (bPacked && StaticComponentView->GetAuthority(ObjectRef.Entity, RPCEndpointComponentId) != WORKER_AUTHORITY_AUTHORITATIVE)
+	{
+		return;
+	}
+
+	const uint32 RPCIndex = Payload.Index;
+	FPendingRPCParamsPtr Params = MakeUnique<FPendingRPCParams>(ObjectRef, MoveTemp(Payload));
+	if (UObject* TargetObject = PackageMap->GetObjectFromUnrealObjectRef(ObjectRef).Get())
+	{
+		const FClassInfo& ClassInfo = ClassInfoManager->GetOrCreateClassInfoByObject(TargetObject);
+		UFunction* Function = ClassInfo.RPCs[RPCIndex];
+		const FRPCInfo& RPCInfo = ClassInfoManager->GetRPCInfo(TargetObject, Function);
 
-		QueueIncomingRPC(MoveTemp(Params));
+		if (!IncomingRPCs.ObjectHasRPCsQueuedOfType(ObjectRef.Entity, RPCInfo.Type))
+		{
+			// Apply if possible, queue otherwise
+			if (ApplyRPC(*Params))
+			{
+				return;
+			}
+		}
 	}
+
+	QueueIncomingRPC(MoveTemp(Params));
 }
 
 void USpatialReceiver::OnCommandRequest(const Worker_CommandRequestOp& Op)
@@ -1303,13 +1720,44 @@ void USpatialReceiver::OnCommandRequest(const Worker_CommandRequestOp& Op)
 
 	Schema_Object* RequestObject = Schema_GetCommandRequestObject(Op.request.schema_type);
 
-	RPCPayload Payload(RequestObject);
-	FUnrealObjectRef ObjectRef = FUnrealObjectRef(Op.entity_id, Payload.Offset);
+	if (Op.request.component_id == SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID && CommandIndex == SpatialConstants::UNREAL_RPC_ENDPOINT_BATCH_COMMAND_ID)
+	{
+		// Batched RPCs are decoded in the order they were sent.
+		TArray<uint8> Batch = GetBytesFromSchema(RequestObject, SpatialConstants::UNREAL_RPC_BATCH_RPCS_ID);
+
+		int32 Position = 0;
+		while (Position < Batch.Num())
+		{
+			uint32 Offset = 0;
+			uint32 Index = 0;
+			TArray<uint8> PayloadData;
+			Worker_EntityId UnusedEntityId = SpatialConstants::INVALID_ENTITY_ID;
+
+			if (!RPCPayload::ReadFromBatch(Batch, Position, Offset, Index, PayloadData, UnusedEntityId))
+			{
+				UE_LOG(LogSpatialReceiver, Error, TEXT("Malformed RPC batch command received on entity %lld. Dropping the rest of the batch."), Op.entity_id);
+				break;
+			}
+
+			ReceiveCrossServerRPC(Op.entity_id, RPCPayload(Offset, Index, MoveTemp(PayloadData)));
+		}
+
+		Sender->SendEmptyCommandResponse(Op.request.component_id, CommandIndex, Op.request_id);
+		return;
+	}
+
+	ReceiveCrossServerRPC(Op.entity_id, RPCPayload(RequestObject));
+
+	Sender->SendEmptyCommandResponse(Op.request.component_id, CommandIndex, Op.request_id);
+}
+
+void USpatialReceiver::ReceiveCrossServerRPC(Worker_EntityId EntityId, RPCPayload&& Payload)
+{
+	FUnrealObjectRef ObjectRef = FUnrealObjectRef(EntityId, Payload.Offset);
 	UObject* TargetObject = PackageMap->GetObjectFromUnrealObjectRef(ObjectRef).Get();
 	if (TargetObject == nullptr)
 	{
-		UE_LOG(LogSpatialReceiver, Warning, TEXT("No target object found for EntityId %d"), Op.entity_id);
-		Sender->SendEmptyCommandResponse(Op.request.component_id, CommandIndex, Op.request_id);
+		UE_LOG(LogSpatialReceiver, Warning, TEXT("No target object found for EntityId %d"), EntityId);
 		return;
 	}
 
@@ -1317,8 +1765,8 @@ void USpatialReceiver::OnCommandRequest(const Worker_CommandRequestOp& Op)
 	UFunction* Function = Info.RPCs[Payload.Index];
 	const FRPCInfo& RPCInfo = ClassInfoManager->GetRPCInfo(TargetObject, Function);
 
-	UE_LOG(LogSpatialReceiver, Verbose, TEXT("Received command request (entity: %lld, component: %d, function: %s)"),
-		Op.entity_id, Op.request.component_id, *Function->GetName());
+	UE_LOG(LogSpatialReceiver, Verbose, TEXT("Received command request (entity: %lld, function: %s)"),
+		EntityId, *Function->GetName());
 
 	bool bAppliedRPC = false;
 	if (!IncomingRPCs.ObjectHasRPCsQueuedOfType(ObjectRef.Entity, RPCInfo.Type))
@@ -1333,8 +1781,6 @@ void USpatialReceiver::OnCommandRequest(const Worker_CommandRequestOp& Op)
 	{
 		QueueIncomingRPC(MakeUnique<FPendingRPCParams>(ObjectRef, MoveTemp(Payload)));
 	}
-
-	Sender->SendEmptyCommandResponse(Op.request.component_id, CommandIndex, Op.request_id);
 }
 
 void USpatialReceiver::OnCommandResponse(const Worker_CommandResponseOp& Op)
@@ -1355,6 +1801,17 @@ void USpatialReceiver::FlushRetryRPCs()
 
 void USpatialReceiver::ReceiveCommandResponse(const Worker_CommandResponseOp& Op)
 {
+	TArray<TSharedRef<FReliableRPCForRetry>> ReliableRPCBatch;
+	if (PendingReliableRPCBatches.RemoveAndCopyValue(Op.request_id, ReliableRPCBatch))
+	{
+		// Each reliable RPC of a failed batch is retried on its own.
+		for (const TSharedRef<FReliableRPCForRetry>& ReliableRPC : ReliableRPCBatch)
+		{
+			HandleReliableRPCResponse(ReliableRPC, Op);
+		}
+		return;
+	}
+
 	TSharedRef<FReliableRPCForRetry>* ReliableRPCPtr = PendingReliableRPCs.Find(Op.request_id);
 	if (ReliableRPCPtr == nullptr)
 	{
@@ -1364,6 +1821,11 @@ void USpatialReceiver::ReceiveCommandResponse(const Worker_CommandResponseOp& Op
 
 	TSharedRef<FReliableRPCForRetry> ReliableRPC = *ReliableRPCPtr;
 	PendingReliableRPCs.Remove(Op.request_id);
+	HandleReliableRPCResponse(ReliableRPC, Op);
+}
+
+void USpatialReceiver::HandleReliableRPCResponse(const TSharedRef<FReliableRPCForRetry>& ReliableRPC, const Worker_CommandResponseOp& Op)
+{
 	if (Op.status_code != WORKER_STATUS_CODE_SUCCESS)
 	{
 		bool bCanRetry = false;
@@ -1418,7 +1880,7 @@ void USpatialReceiver::ApplyComponentUpdate(const Worker_ComponentUpdate& Compon
 	FObjectReferencesMap& ObjectReferencesMap = UnresolvedRefsMap.FindOrAdd(ChannelObjectPair);
 	TSet<FUnrealObjectRef> UnresolvedRefs;
 	ComponentReader Reader(NetDriver, ObjectReferencesMap, UnresolvedRefs);
-	Reader.ApplyComponentUpdate(ComponentUpdate, TargetObject, Channel, bIsHandover);
+	Reader.ApplyComponentUpdate(ComponentUpdate, TargetObject, Channel, bIsHandover, ParsedUpdateScratch);
 
 	// This is a temporary workaround, see UNR-841:
 	// If the update includes tearoff, close the channel and clean up the entity.
@@ -1462,8 +1924,15 @@ bool USpatialReceiver::ApplyRPC(UObject* TargetObject, UFunction* Function, cons
 		}
 	}
 
-	TSharedPtr<FRepLayout> RepLayout = NetDriver->GetFunctionRepLayout(Function);
-	RepLayout_ReceivePropertiesForRPC(*RepLayout, PayloadReader, Parms);
+	if (GetDefault<USpatialGDKSettings>()->bUseRPCParameterCodecs)
+	{
+		NetDriver->GetRPCParameterCodec(Function)->Read(PayloadReader, Parms);
+	}
+	else
+	{
+		TSharedPtr<FRepLayout> RepLayout = NetDriver->GetFunctionRepLayout(Function);
+		RepLayout_ReceivePropertiesForRPC(*RepLayout, PayloadReader, Parms);
+	}
 
 	if ((UnresolvedRefs.Num() == 0) || bApplyWithUnresolvedRefs)
 	{
@@ -1598,6 +2067,11 @@ void USpatialReceiver::AddPendingReliableRPC(Worker_RequestId RequestId, TShared
 	PendingReliableRPCs.Add(RequestId, ReliableRPC);
 }
 
+void USpatialReceiver::AddPendingReliableRPCBatch(Worker_RequestId RequestId, TArray<TSharedRef<FReliableRPCForRetry>>&& ReliableRPCs)
+{
+	PendingReliableRPCBatches.Add(RequestId, MoveTemp(ReliableRPCs));
+}
+
 void USpatialReceiver::AddEntityQueryDelegate(Worker_RequestId RequestId, EntityQueryDelegate Delegate)
 {
 	EntityQueryDelegates.Add(RequestId, Delegate);
@@ -1648,12 +2122,34 @@ void USpatialReceiver::ProcessQueuedResolvedObjects()
 	ResolvedObjectQueue.Empty();
 }
 
-void USpatialReceiver::ProcessQueuedActorRPCsOnEntityCreation(AActor* Actor, RPCsOnEntityCreation& QueuedRPCs)
+void USpatialReceiver::ClearAcknowledgedRPCsOnEntityCreation(const Worker_ComponentUpdateOp& Op)
+{
+	if (!NetDriver->IsServer() || !StaticComponentView->HasAuthority(Op.entity_id, SpatialConstants::RPCS_ON_ENTITY_CREATION_ID))
+	{
+		return;
+	}
+
+	Schema_Object* EndpointObject = Schema_GetComponentUpdateFields(Op.update.schema_type);
+	if (Schema_GetUint32Count(EndpointObject, SpatialConstants::UNREAL_CLIENT_RPC_ENDPOINT_ACKED_RPCS_ON_ENTITY_CREATION_ID) == 0 ||
+		Schema_GetUint32(EndpointObject, SpatialConstants::UNREAL_CLIENT_RPC_ENDPOINT_ACKED_RPCS_ON_ENTITY_CREATION_ID) == 0)
+	{
+		return;
+	}
+
+	RPCsOnEntityCreation* QueuedRPCs = StaticComponentView->GetComponentData<RPCsOnEntityCreation>(Op.entity_id);
+	if (QueuedRPCs != nullptr && QueuedRPCs->HasRPCPayloadData())
+	{
+		Sender->ClearRPCsOnEntityCreation(Op.entity_id);
+	}
+}
+
+void USpatialReceiver::ProcessQueuedActorRPCsOnEntityCreation(AActor* Actor, RPCsOnEntityCreation& QueuedRPCs, uint32 FirstRPCIndex)
 {
 	const FClassInfo& Info = ClassInfoManager->GetOrCreateClassInfoByClass(Actor->GetClass());
 
-	for (auto& RPC : QueuedRPCs.RPCs)
+	for (int32 i = FirstRPCIndex; i < QueuedRPCs.RPCs.Num(); i++)
 	{
+		RPCPayload& RPC = QueuedRPCs.RPCs[i];
 		UFunction* Function = Info.RPCs[RPC.Index];
 		const FRPCInfo& RPCInfo = ClassInfoManager->GetRPCInfo(Actor, Function);
 		const FUnrealObjectRef ObjectRef = PackageMap->GetUnrealObjectRefFromObject(Actor);
@@ -1859,10 +2355,16 @@ void USpatialReceiver::ResolveObjectReferences(FRepLayout& RepLayout, UObject* R
 			FUnrealObjectRef& ObjectRef = *UnresolvedIt;
 
 			FNetworkGUID NetGUID = PackageMap->GetNetGUIDFromUnrealObjectRef(ObjectRef);
-			if (NetGUID.IsValid())
+			if (NetGUID.IsValid() && !PackageMap->TryAsyncLoadStablyNamedObject(ObjectRef))
 			{
 				UObject* Object = PackageMap->GetObjectFromNetGUID(NetGUID, true);
-				check(Object);
+				if (Object == nullptr)
+				{
+					// Stably named objects can be missing from their package once it has loaded, or their package failed to load.
+					check(ObjectRef.Path.IsSet());
+					UE_LOG(LogSpatialReceiver, Warning, TEXT("ResolveObjectReferences: Could not find stably named object, keeping it unresolved. Object ref: %s, PropName: %s"), *ObjectRef.ToString(), *Property->GetNameCPP());
+					continue;
+				}
 
 				UE_LOG(LogSpatialReceiver, Verbose, TEXT("ResolveObjectReferences: Resolved object ref: Offset: %d, Object ref: %s, PropName: %s, ObjName: %s"), AbsOffset, *ObjectRef.ToString(), *Property->GetNameCPP(), *Object->GetName());
 
@@ -1959,6 +2461,7 @@ void USpatialReceiver::OnHeartbeatComponentUpdate(const Worker_ComponentUpdateOp
 	{
 		UE_LOG(LogSpatialReceiver, Warning, TEXT("Received heartbeat component update after NetConnection has been cleaned up. PlayerController entity: %lld"), Op.entity_id);
 		AuthorityPlayerControllerConnectionMap.Remove(Op.entity_id);
+		ClientHeartbeats.Remove(Op.entity_id);
 		return;
 	}
 
@@ -1973,7 +2476,7 @@ void USpatialReceiver::OnHeartbeatComponentUpdate(const Worker_ComponentUpdateOp
 			UE_LOG(LogSpatialReceiver, Verbose, TEXT("Received multiple heartbeat events in a single component update, entity %lld."), Op.entity_id);
 		}
 
-		NetConnection->OnHeartbeat();
+		ClientHeartbeats.OnHeartbeat(Op.entity_id, FPlatformTime::Seconds());
 	}
 
 	Schema_Object* FieldsObject = Schema_GetComponentUpdateFields(Op.update.schema_type);
@@ -1983,5 +2486,22 @@ void USpatialReceiver::OnHeartbeatComponentUpdate(const Worker_ComponentUpdateOp
 		// Client has disconnected, let's clean up their connection.
 		NetConnection->CleanUp();
 		AuthorityPlayerControllerConnectionMap.Remove(Op.entity_id);
+		ClientHeartbeats.Remove(Op.entity_id);
+	}
+}
+
+void USpatialReceiver::CheckClientHeartbeats()
+{
+	TArray<Worker_EntityId> TimedOutEntities;
+	ClientHeartbeats.RemoveTimedOut(FPlatformTime::Seconds() - GetDefault<USpatialGDKSettings>()->HeartbeatTimeoutSeconds, TimedOutEntities);
+
+	for (Worker_EntityId EntityId : TimedOutEntities)
+	{
+		TWeakObjectPtr<USpatialNetConnection> Connection;
+		if (AuthorityPlayerControllerConnectionMap.RemoveAndCopyValue(EntityId, Connection) && Connection.IsValid())
+		{
+			// This client timed out. Disconnect it and trigger OnDisconnected logic.
+			Connection->CleanUp();
+		}
 	}
 } 
@@ -27,8 +27,8 @@
 #include "Utils/ActorGroupManager.h"
 #include "Utils/ComponentFactory.h"
 #include "Utils/InterestFactory.h"
+#include "Utils/RPCParameterCodec.h"
 #include "Utils/RepLayoutUtils.h"
-#include "Utils/SpatialActorUtils.h"
 #include "Utils/SpatialMetrics.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialSender);
@@ -75,7 +75,7 @@ Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel)
 	AActor* Actor = Channel->Actor;
 	UClass* Class = Actor->GetClass();
 
-	FString ClientWorkerAttribute = GetOwnerWorkerAttribute(Actor);
+	FString ClientWorkerAttribute = Channel->GetOwnerWorkerAttribute();
 
 	WorkerRequirementSet AnyServerRequirementSet;
 	WorkerRequirementSet AnyServerOrClientRequirementSet = { SpatialConstants::UnrealClientAttributeSet };
@@ -150,6 +150,11 @@ Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel)
 		ComponentWriteAcl.Add(ComponentId, AuthoritativeWorkerRequirementSet);
 	});
 
+	for (Worker_ComponentId ComponentId : Info.PropertyGroupComponents)
+	{
+		ComponentWriteAcl.Add(ComponentId, AuthoritativeWorkerRequirementSet);
+	}
+
 	for (auto& SubobjectInfoPair : Info.SubobjectInfo)
 	{
 		const FClassInfo& SubobjectInfo = SubobjectInfoPair.Value.Get();
@@ -197,12 +202,25 @@ Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel)
 		bNetStartup = Actor->bNetStartup;
 	}
 
+	// Classes are identified by their persistent id in the schema database, which is much smaller than the class path.
+	// The path is only written for classes without an id, i.e. when the schema database predates class ids.
+	TSchemaOption<uint32> ClassId;
+	FString ClassPath;
+	if (Info.ClassId != 0)
+	{
+		ClassId = Info.ClassId;
+	}
+	else
+	{
+		ClassPath = Class->GetPathName();
+	}
+
 	TArray<Worker_ComponentData> ComponentDatas;
 	ComponentDatas.Add(Position(Coordinates::FromFVector(Channel->GetActorSpatialPosition(Actor))).CreatePositionData());
 	ComponentDatas.Add(Metadata(Class->GetName()).CreateMetadataData());
 	ComponentDatas.Add(Persistence().CreatePersistenceData());
 	ComponentDatas.Add(SpawnData(Actor).CreateSpawnDataData());
-	ComponentDatas.Add(UnrealMetadata(StablyNamedObjectRef, ClientWorkerAttribute, Class->GetPathName(), bNetStartup).CreateUnrealMetadataData());
+	ComponentDatas.Add(UnrealMetadata(StablyNamedObjectRef, ClientWorkerAttribute, ClassPath, bNetStartup, ClassId).CreateUnrealMetadataData());
 
 	if (RPCsOnEntityCreation* QueuedRPCs = OutgoingOnCreateEntityRPCs.Find(Actor))
 	{
@@ -564,7 +582,7 @@ void USpatialSender::SendComponentUpdates(UObject* Object, const FClassInfo& Inf
 			{
 				ResetOutgoingUpdate(Channel, Object, Handle, /* bIsHandover */ false);
 
-				if (TSet<TWeakObjectPtr<const UObject>>* UnresolvedObjects = UnresolvedObjectsMap.Find(Handle))
+				if (FUnresolvedObjectsSet* UnresolvedObjects = UnresolvedObjectsMap.Find(Handle))
 				{
 					QueueOutgoingUpdate(Channel, Object, Handle, *UnresolvedObjects, /* bIsHandover */ false);
 				}
@@ -578,7 +596,7 @@ void USpatialSender::SendComponentUpdates(UObject* Object, const FClassInfo& Inf
 		{
 			ResetOutgoingUpdate(Channel, Object, Handle, /* bIsHandover */ true);
 
-			if (TSet<TWeakObjectPtr<const UObject>>* UnresolvedObjects = HandoverUnresolvedObjectsMap.Find(Handle))
+			if (FUnresolvedObjectsSet* UnresolvedObjects = HandoverUnresolvedObjectsMap.Find(Handle))
 			{
 				QueueOutgoingUpdate(Channel, Object, Handle, *UnresolvedObjects, /* bIsHandover */ true);
 			}
@@ -637,22 +655,123 @@ void USpatialSender::FlushPackedRPCs()
 		ComponentUpdate.schema_type = Schema_CreateComponentUpdate(ComponentId);
 		Schema_Object* EventsObject = Schema_GetComponentUpdateEvents(ComponentUpdate.schema_type);
 
-		for (const FPendingRPC& RPC : PendingRPCArray)
+		if (GetDefault<USpatialGDKSettings>()->bBatchRPCEvents)
+		{
+			AddRPCBatchEvent(EventsObject, SpatialConstants::UNREAL_RPC_ENDPOINT_PACKED_BATCH_EVENT_ID, PendingRPCArray, /* bPacked */ true);
+		}
+		else
 		{
-			Schema_Object* EventData = Schema_AddObject(EventsObject, SpatialConstants::UNREAL_RPC_ENDPOINT_PACKED_EVENT_ID);
+			for (const FPendingRPC& RPC : PendingRPCArray)
+			{
+				Schema_Object* EventData = Schema_AddObject(EventsObject, SpatialConstants::UNREAL_RPC_ENDPOINT_PACKED_EVENT_ID);
 
-			Schema_AddUint32(EventData, SpatialConstants::UNREAL_RPC_PAYLOAD_OFFSET_ID, RPC.Offset);
-			Schema_AddUint32(EventData, SpatialConstants::UNREAL_RPC_PAYLOAD_RPC_INDEX_ID, RPC.Index);
-			SpatialGDK::AddBytesToSchema(EventData, SpatialConstants::UNREAL_RPC_PAYLOAD_RPC_PAYLOAD_ID, RPC.Data.GetData(), RPC.Data.Num());
-			Schema_AddEntityId(EventData, SpatialConstants::UNREAL_PACKED_RPC_PAYLOAD_ENTITY_ID, RPC.Entity);
+				Schema_AddUint32(EventData, SpatialConstants::UNREAL_RPC_PAYLOAD_OFFSET_ID, RPC.Offset);
+				Schema_AddUint32(EventData, SpatialConstants::UNREAL_RPC_PAYLOAD_RPC_INDEX_ID, RPC.Index);
+				SpatialGDK::AddBytesToSchema(EventData, SpatialConstants::UNREAL_RPC_PAYLOAD_RPC_PAYLOAD_ID, RPC.Data.GetData(), RPC.Data.Num());
+				Schema_AddEntityId(EventData, SpatialConstants::UNREAL_PACKED_RPC_PAYLOAD_ENTITY_ID, RPC.Entity);
+			}
 		}
 
 		Connection->SendComponentUpdate(PlayerControllerEntityId, &ComponentUpdate);
+		OnClientRPCUpdateSent(PlayerControllerEntityId);
 	}
 
 	RPCsToPack.Empty();
 }
 
+void USpatialSender::FlushBatchedRPCs()
+{
+	if (RPCsToBatch.Num() == 0)
+	{
+		return;
+	}
+
+	for (const auto& EntityIt : RPCsToBatch)
+	{
+		Worker_EntityId EntityId = EntityIt.Key;
+
+		for (const auto& ComponentIt : EntityIt.Value)
+		{
+			Worker_ComponentId ComponentId = ComponentIt.Key;
+
+			Worker_ComponentUpdate ComponentUpdate = {};
+			ComponentUpdate.component_id = ComponentId;
+			ComponentUpdate.schema_type = Schema_CreateComponentUpdate(ComponentId);
+			Schema_Object* EventsObject = Schema_GetComponentUpdateEvents(ComponentUpdate.schema_type);
+
+			const Schema_FieldId EventId = ComponentId == SpatialConstants::NETMULTICAST_RPCS_COMPONENT_ID
+				? SpatialConstants::UNREAL_MULTICAST_RPC_ENDPOINT_BATCH_EVENT_ID : SpatialConstants::UNREAL_RPC_ENDPOINT_BATCH_EVENT_ID;
+			AddRPCBatchEvent(EventsObject, EventId, ComponentIt.Value, /* bPacked */ false);
+
+			Connection->SendComponentUpdate(EntityId, &ComponentUpdate);
+			OnClientRPCUpdateSent(EntityId);
+		}
+	}
+
+	RPCsToBatch.Empty();
+}
+
+void USpatialSender::FlushCrossServerRPCs()
+{
+	if (CrossServerRPCsToBatch.Num() == 0)
+	{
+		return;
+	}
+
+	for (auto& It : CrossServerRPCsToBatch)
+	{
+		Worker_EntityId EntityId = It.Key;
+		FPendingCrossServerRPCBatch& Batch = It.Value;
+
+		TArray<uint8> BatchData;
+		for (const FPendingRPC& RPC : Batch.RPCs)
+		{
+			RPCPayload::AppendToBatch(BatchData, RPC.Offset, RPC.Index, RPC.Data.GetData(), RPC.Data.Num());
+		}
+
+		Worker_CommandRequest CommandRequest = {};
+		CommandRequest.component_id = SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID;
+		CommandRequest.schema_type = Schema_CreateCommandRequest(SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID, SpatialConstants::UNREAL_RPC_ENDPOINT_BATCH_COMMAND_ID);
+		Schema_Object* RequestObject = Schema_GetCommandRequestObject(CommandRequest.schema_type);
+		SpatialGDK::AddBytesToSchema(RequestObject, SpatialConstants::UNREAL_RPC_BATCH_RPCS_ID, BatchData.GetData(), BatchData.Num());
+
+		Worker_RequestId RequestId = Connection->SendCommandRequest(EntityId, &CommandRequest, SpatialConstants::UNREAL_RPC_ENDPOINT_BATCH_COMMAND_ID);
+
+		UE_LOG(LogSpatialSender, Verbose, TEXT("Sending command request with %d batched RPCs (entity: %lld, reliable: %d)"),
+			Batch.RPCs.Num(), EntityId, Batch.ReliableRPCs.Num());
+
+		if (Batch.ReliableRPCs.Num() > 0)
+		{
+			Receiver->AddPendingReliableRPCBatch(RequestId, MoveTemp(Batch.ReliableRPCs));
+		}
+	}
+
+	CrossServerRPCsToBatch.Empty();
+}
+
+void USpatialSender::OnClientRPCUpdateSent(Worker_EntityId EntityId)
+{
+	if (!NetDriver->IsServer())
+	{
+		if (USpatialNetConnection* NetConnection = NetDriver->GetSpatialOSNetConnection())
+		{
+			NetConnection->ClientOnUpdateSent(EntityId);
+		}
+	}
+}
+
+void USpatialSender::AddRPCBatchEvent(Schema_Object* EventsObject, Schema_FieldId EventId, const TArray<FPendingRPC>& RPCs, bool bPacked)
+{
+	TArray<uint8> Batch;
+	for (const FPendingRPC& RPC : RPCs)
+	{
+		RPCPayload::AppendToBatch(Batch, RPC.Offset, RPC.Index, RPC.Data.GetData(), RPC.Data.Num(), bPacked ? RPC.Entity : 0);
+	}
+
+	Schema_Object* EventData = Schema_AddObject(EventsObject, EventId);
+	SpatialGDK::AddBytesToSchema(EventData, SpatialConstants::UNREAL_RPC_BATCH_RPCS_ID, Batch.GetData(), Batch.Num());
+}
+
 void FillComponentInterests(const FClassInfo& Info, bool bNetOwned, TArray<Worker_InterestOverride>& ComponentInterest)
 {
 	if (Info.SchemaComponents[SCHEMA_OwnerOnly] != SpatialConstants::INVALID_COMPONENT_ID)
@@ -778,7 +897,7 @@ bool USpatialSender::SendRPC(const FPendingRPCParams& Params)
 			}
 			check(NetDriver->IsServer());
 
-			OutgoingOnCreateEntityRPCs.FindOrAdd(TargetObject).RPCs.Add(Params.Payload);
+			AddRPCOnEntityCreation(TargetObject, Function, Params.Payload);
 #if !UE_BUILD_SHIPPING
 			NetDriver->SpatialMetrics->TrackSentRPC(Function, RPCInfo.Type, Params.Payload.PayloadData.Num());
 #endif // !UE_BUILD_SHIPPING
@@ -798,6 +917,20 @@ bool USpatialSender::SendRPC(const FPendingRPCParams& Params)
 	{
 		Worker_ComponentId ComponentId = SchemaComponentTypeToWorkerComponentId(RPCInfo.Type);
 
+		if (GetDefault<USpatialGDKSettings>()->bBatchCrossServerRPCs)
+		{
+			const UObject* UnresolvedObject = nullptr;
+			if (!AddCrossServerRPCToBatch(TargetObject, Function, Params.Payload, ComponentId, UnresolvedObject))
+			{
+				return false;
+			}
+
+#if !UE_BUILD_SHIPPING
+			NetDriver->SpatialMetrics->TrackSentRPC(Function, RPCInfo.Type, Params.Payload.PayloadData.Num());
+#endif // !UE_BUILD_SHIPPING
+			return true;
+		}
+
 		const UObject* UnresolvedObject = nullptr;
 		Worker_CommandRequest CommandRequest = CreateRPCCommandRequest(TargetObject, Params.Payload, ComponentId, RPCInfo.Index, EntityId, UnresolvedObject);
 
@@ -902,6 +1035,20 @@ bool USpatialSender::SendRPC(const FPendingRPCParams& Params)
 				return false;
 			}
 
+			if (GetDefault<USpatialGDKSettings>()->bBatchRPCEvents)
+			{
+				const UObject* UnresolvedObject = nullptr;
+				if (!AddBatchedRPC(TargetObject, Params.Payload, ComponentId, UnresolvedObject))
+				{
+					return false;
+				}
+
+#if !UE_BUILD_SHIPPING
+				NetDriver->SpatialMetrics->TrackSentRPC(Function, RPCInfo.Type, Params.Payload.PayloadData.Num());
+#endif // !UE_BUILD_SHIPPING
+				return true;
+			}
+
 			const UObject* UnresolvedParameter = nullptr;
 			Worker_ComponentUpdate ComponentUpdate = CreateRPCEventUpdate(TargetObject, Params.Payload, ComponentId, RPCInfo.Index, UnresolvedParameter);
 
@@ -911,6 +1058,7 @@ bool USpatialSender::SendRPC(const FPendingRPCParams& Params)
 			}
 
 			Connection->SendComponentUpdate(EntityId, &ComponentUpdate);
+			OnClientRPCUpdateSent(EntityId);
 #if !UE_BUILD_SHIPPING
 			NetDriver->SpatialMetrics->TrackSentRPC(Function, RPCInfo.Type, Params.Payload.PayloadData.Num());
 #endif // !UE_BUILD_SHIPPING
@@ -996,10 +1144,39 @@ void USpatialSender::SendDeleteEntityRequest(Worker_EntityId EntityId)
 	Connection->SendDeleteEntityRequest(EntityId);
 }
 
-void USpatialSender::SendRequestToClearRPCsOnEntityCreation(Worker_EntityId EntityId)
+void USpatialSender::AddRPCOnEntityCreation(UObject* TargetObject, UFunction* Function, const RPCPayload& Payload)
 {
-	Worker_CommandRequest CommandRequest = RPCsOnEntityCreation::CreateClearFieldsCommandRequest();
-	NetDriver->Connection->SendCommandRequest(EntityId, &CommandRequest, SpatialConstants::CLEAR_RPCS_ON_ENTITY_CREATION);
+	TArray<RPCPayload>& QueuedRPCs = OutgoingOnCreateEntityRPCs.FindOrAdd(TargetObject).RPCs;
+
+	const uint32 MaxRPCs = GetDefault<USpatialGDKSettings>()->MaxRPCsOnEntityCreation;
+	if ((uint32)QueuedRPCs.Num() >= MaxRPCs)
+	{
+		if (!Function->HasAnyFunctionFlags(FUNC_NetReliable))
+		{
+			UE_LOG(LogSpatialSender, Verbose, TEXT("Dropping unreliable RPC %s on Object %s, %d RPCs are already queued on entity creation."), *Function->GetName(), *TargetObject->GetName(), QueuedRPCs.Num());
+			return;
+		}
+
+		// Make room for the reliable RPC by dropping the oldest unreliable one.
+		const FClassInfo& ClassInfo = ClassInfoManager->GetOrCreateClassInfoByObject(TargetObject);
+		const int32 UnreliableIndex = QueuedRPCs.IndexOfByPredicate([&ClassInfo](const RPCPayload& QueuedRPC)
+		{
+			return !ClassInfo.RPCs[QueuedRPC.Index]->HasAnyFunctionFlags(FUNC_NetReliable);
+		});
+
+		if (UnreliableIndex == INDEX_NONE)
+		{
+			UE_LOG(LogSpatialSender, Warning, TEXT("Dropping reliable RPC %s on Object %s, %d reliable RPCs are already queued on entity creation. Consider raising MaxRPCsOnEntityCreation."),
+				*Function->GetName(), *TargetObject->GetName(), QueuedRPCs.Num());
+			return;
+		}
+
+		UE_LOG(LogSpatialSender, Verbose, TEXT("Dropping unreliable RPC %s on Object %s to queue reliable RPC %s on entity creation."),
+			*ClassInfo.RPCs[QueuedRPCs[UnreliableIndex].Index]->GetName(), *TargetObject->GetName(), *Function->GetName());
+		QueuedRPCs.RemoveAt(UnreliableIndex);
+	}
+
+	QueuedRPCs.Add(Payload);
 }
 
 void USpatialSender::ClearRPCsOnEntityCreation(Worker_EntityId EntityId)
@@ -1013,6 +1190,18 @@ void USpatialSender::SendClientEndpointReadyUpdate(Worker_EntityId EntityId)
 {
 	ClientRPCEndpoint Endpoint;
 	Endpoint.bReady = true;
+
+	// Acknowledge the RPCs queued on entity creation, which the receiver has executed by now.
+	// The authoritative server clears them when it sees this, without the client sending a clear_rpcs command.
+	if (ClientRPCEndpoint* CurrentEndpoint = StaticComponentView->GetComponentData<ClientRPCEndpoint>(EntityId))
+	{
+		Endpoint.AckedRPCsOnEntityCreation = CurrentEndpoint->AckedRPCsOnEntityCreation;
+	}
+	if (RPCsOnEntityCreation* QueuedRPCs = StaticComponentView->GetComponentData<RPCsOnEntityCreation>(EntityId))
+	{
+		Endpoint.AckedRPCsOnEntityCreation = FMath::Max(Endpoint.AckedRPCsOnEntityCreation, (uint32)QueuedRPCs->RPCs.Num());
+	}
+
 	Worker_ComponentUpdate Update = Endpoint.CreateRPCEndpointUpdate();
 	NetDriver->Connection->SendComponentUpdate(EntityId, &Update);
 }
@@ -1034,54 +1223,20 @@ void USpatialSender::ResetOutgoingUpdate(USpatialActorChannel* DependentChannel,
 	const FChannelObjectPair ChannelObjectPair(DependentChannel, ReplicatedObject);
 
 	// Choose the correct container based on whether it's handover or not
-	FChannelToHandleToUnresolved& PropertyToUnresolved = bIsHandover ? HandoverPropertyToUnresolved : RepPropertyToUnresolved;
-	FOutgoingRepUpdates& ObjectToUnresolved = bIsHandover ? HandoverObjectToUnresolved : RepObjectToUnresolved;
+	FUnresolvedObjectsTracker& UnresolvedTracker = bIsHandover ? HandoverUnresolvedTracker : RepUnresolvedTracker;
 
-	FHandleToUnresolved* HandleToUnresolved = PropertyToUnresolved.Find(ChannelObjectPair);
-	if (HandleToUnresolved == nullptr)
+	if (!UnresolvedTracker.HasPendingUpdate(ChannelObjectPair, Handle))
 	{
 		return;
 	}
 
-	FUnresolvedEntry* UnresolvedPtr = HandleToUnresolved->Find(Handle);
-	if (UnresolvedPtr == nullptr)
-	{
-		return;
-	}
-
-	FUnresolvedEntry& Unresolved = *UnresolvedPtr;
-
-	check(Unresolved.IsValid());
-
 	UE_LOG(LogSpatialSender, Log, TEXT("Resetting pending outgoing array depending on channel: %s, object: %s, handle: %d."),
 		*DependentChannel->GetName(), *ReplicatedObject->GetName(), Handle);
 
-	// Remove any references to the unresolved objects.
-	// Since these are not dereferenced before removing, it is safe to not check whether the unresolved object is still valid.
-	for (TWeakObjectPtr<const UObject>& UnresolvedObject : *Unresolved)
-	{
-		FChannelToHandleToUnresolved& ChannelToUnresolved = ObjectToUnresolved.FindChecked(UnresolvedObject);
-		FHandleToUnresolved& OtherHandleToUnresolved = ChannelToUnresolved.FindChecked(ChannelObjectPair);
-
-		OtherHandleToUnresolved.Remove(Handle);
-		if (OtherHandleToUnresolved.Num() == 0)
-		{
-			ChannelToUnresolved.Remove(ChannelObjectPair);
-			if (ChannelToUnresolved.Num() == 0)
-			{
-				ObjectToUnresolved.Remove(UnresolvedObject);
-			}
-		}
-	}
-
-	HandleToUnresolved->Remove(Handle);
-	if (HandleToUnresolved->Num() == 0)
-	{
-		PropertyToUnresolved.Remove(ChannelObjectPair);
-	}
+	UnresolvedTracker.ResetUpdate(ChannelObjectPair, Handle);
 }
 
-void USpatialSender::QueueOutgoingUpdate(USpatialActorChannel* DependentChannel, UObject* ReplicatedObject, int16 Handle, const TSet<TWeakObjectPtr<const UObject>>& UnresolvedObjects, bool bIsHandover)
+void USpatialSender::QueueOutgoingUpdate(USpatialActorChannel* DependentChannel, UObject* ReplicatedObject, int16 Handle, const FUnresolvedObjectsSet& UnresolvedObjects, bool bIsHandover)
 {
 	SCOPE_CYCLE_COUNTER(STAT_SpatialSenderQueueOutgoingUpdate);
 	check(DependentChannel);
@@ -1091,34 +1246,19 @@ void USpatialSender::QueueOutgoingUpdate(USpatialActorChannel* DependentChannel,
 	UE_LOG(LogSpatialSender, Log, TEXT("Added pending outgoing property: channel: %s, object: %s, handle: %d. Depending on objects:"),
 		*DependentChannel->GetName(), *ReplicatedObject->GetName(), Handle);
 
-	// Choose the correct container based on whether it's handover or not
-	FChannelToHandleToUnresolved& PropertyToUnresolved = bIsHandover ? HandoverPropertyToUnresolved : RepPropertyToUnresolved;
-	FOutgoingRepUpdates& ObjectToUnresolved = bIsHandover ? HandoverObjectToUnresolved : RepObjectToUnresolved;
-
-	FUnresolvedEntry Unresolved = MakeShared<TSet<TWeakObjectPtr<const UObject>>>();
-	*Unresolved = UnresolvedObjects;
-
-	FHandleToUnresolved& HandleToUnresolved = PropertyToUnresolved.FindOrAdd(ChannelObjectPair);
-	if (HandleToUnresolved.Find(Handle))
-	{
-		HandleToUnresolved.Remove(Handle);
-	}
-	HandleToUnresolved.Add(Handle, Unresolved);
-
 	for (const TWeakObjectPtr<const UObject>& UnresolvedObject : UnresolvedObjects)
 	{
 		// It is expected that this will never be reached. We should never have added an invalid object as an unresolved reference.
 		// Check the ComponentFactory.cpp should this ever be triggered.
 		checkf(UnresolvedObject.IsValid(), TEXT("Invalid UnresolvedObject passed in to USpatialSender::QueueOutgoingUpdate"));
 
-		FHandleToUnresolved& AnotherHandleToUnresolved = ObjectToUnresolved.FindOrAdd(UnresolvedObject).FindOrAdd(ChannelObjectPair);
-		check(!AnotherHandleToUnresolved.Find(Handle));
-		AnotherHandleToUnresolved.Add(Handle, Unresolved);
-
 		// Following up on the previous log: listing the unresolved objects
 		UE_LOG(LogSpatialSender, Log, TEXT("- %s"), *UnresolvedObject->GetName());
-
 	}
+
+	// Choose the correct container based on whether it's handover or not
+	FUnresolvedObjectsTracker& UnresolvedTracker = bIsHandover ? HandoverUnresolvedTracker : RepUnresolvedTracker;
+	UnresolvedTracker.QueueUpdate(ChannelObjectPair, Handle, UnresolvedObjects);
 }
 
 void USpatialSender::QueueOutgoingRPC(FPendingRPCParamsPtr Params)
@@ -1152,8 +1292,15 @@ FSpatialNetBitWriter USpatialSender::PackRPCDataToSpatialNetBitWriter(UFunction*
 		}
 	}
 
-	TSharedPtr<FRepLayout> RepLayout = NetDriver->GetFunctionRepLayout(Function);
-	RepLayout_SendPropertiesForRPC(*RepLayout, PayloadWriter, Parameters);
+	if (GetDefault<USpatialGDKSettings>()->bUseRPCParameterCodecs)
+	{
+		NetDriver->GetRPCParameterCodec(Function)->Write(PayloadWriter, Parameters);
+	}
+	else
+	{
+		TSharedPtr<FRepLayout> RepLayout = NetDriver->GetFunctionRepLayout(Function);
+		RepLayout_SendPropertiesForRPC(*RepLayout, PayloadWriter, Parameters);
+	}
 
 	return PayloadWriter;
 }
@@ -1228,7 +1375,8 @@ bool USpatialSender::AddPendingRPC(UObject* TargetObject, const FPendingRPCParam
 
 	AActor* TargetActor = Cast<AActor>(PackageMap->GetObjectFromEntityId(TargetObjectRef.Entity).Get());
 	check(TargetActor != nullptr);
-	UNetConnection* OwningConnection = TargetActor->GetNetConnection();
+	USpatialActorChannel* TargetChannel = NetDriver->GetActorChannelByEntityId(TargetObjectRef.Entity);
+	UNetConnection* OwningConnection = TargetChannel != nullptr ? TargetChannel->GetOwnerNetConnection() : TargetActor->GetNetConnection();
 	if (OwningConnection == nullptr)
 	{
 		UE_LOG(LogSpatialSender, Warning, TEXT("AddPendingRPC: No connection for object %s (RPC %s, actor %s, entity %lld)"),
@@ -1269,6 +1417,50 @@ bool USpatialSender::AddPendingRPC(UObject* TargetObject, const FPendingRPCParam
 	return true;
 }
 
+bool USpatialSender::AddBatchedRPC(UObject* TargetObject, const RPCPayload& Payload, Worker_ComponentId ComponentId, const UObject*& OutUnresolvedObject)
+{
+	FUnrealObjectRef TargetObjectRef(PackageMap->GetUnrealObjectRefFromNetGUID(PackageMap->GetNetGUIDFromObject(TargetObject)));
+	if (TargetObjectRef == FUnrealObjectRef::UNRESOLVED_OBJECT_REF)
+	{
+		OutUnresolvedObject = TargetObject;
+		return false;
+	}
+
+	FPendingRPC RPC;
+	RPC.Offset = Payload.Offset;
+	RPC.Index = Payload.Index;
+	RPC.Data = Payload.PayloadData;
+	RPC.Entity = TargetObjectRef.Entity;
+	RPCsToBatch.FindOrAdd(TargetObjectRef.Entity).FindOrAdd(ComponentId).Emplace(MoveTemp(RPC));
+	return true;
+}
+
+bool USpatialSender::AddCrossServerRPCToBatch(UObject* TargetObject, UFunction* Function, const RPCPayload& Payload, Worker_ComponentId ComponentId, const UObject*& OutUnresolvedObject)
+{
+	FUnrealObjectRef TargetObjectRef(PackageMap->GetUnrealObjectRefFromNetGUID(PackageMap->GetNetGUIDFromObject(TargetObject)));
+	if (TargetObjectRef == FUnrealObjectRef::UNRESOLVED_OBJECT_REF)
+	{
+		OutUnresolvedObject = TargetObject;
+		return false;
+	}
+
+	FPendingCrossServerRPCBatch& Batch = CrossServerRPCsToBatch.FindOrAdd(TargetObjectRef.Entity);
+
+	FPendingRPC RPC;
+	RPC.Offset = Payload.Offset;
+	RPC.Index = Payload.Index;
+	RPC.Data = Payload.PayloadData;
+	RPC.Entity = TargetObjectRef.Entity;
+	Batch.RPCs.Emplace(MoveTemp(RPC));
+
+	if (Function->HasAnyFunctionFlags(FUNC_NetReliable))
+	{
+		Batch.ReliableRPCs.Add(MakeShared<FReliableRPCForRetry>(TargetObject, Function, ComponentId, Payload.Index, Payload.PayloadData, 0));
+	}
+
+	return true;
+}
+
 void USpatialSender::SendCommandResponse(Worker_RequestId request_id, Worker_CommandResponse& Response)
 {
 	Connection->SendCommandResponse(request_id, &Response);
@@ -1286,16 +1478,12 @@ void USpatialSender::SendEmptyCommandResponse(Worker_ComponentId ComponentId, Sc
 void USpatialSender::ResolveOutgoingOperations(UObject* Object, bool bIsHandover)
 {
 	// Choose the correct container based on whether it's handover or not
-	FChannelToHandleToUnresolved& PropertyToUnresolved = bIsHandover ? HandoverPropertyToUnresolved : RepPropertyToUnresolved;
-	FOutgoingRepUpdates& ObjectToUnresolved = bIsHandover ? HandoverObjectToUnresolved : RepObjectToUnresolved;
+	FUnresolvedObjectsTracker& UnresolvedTracker = bIsHandover ? HandoverUnresolvedTracker : RepUnresolvedTracker;
 
-	FChannelToHandleToUnresolved* ChannelToUnresolved = ObjectToUnresolved.Find(Object);
-	if (!ChannelToUnresolved)
-	{
-		return;
-	}
+	TMap<FChannelObjectPair, TArray<uint16>> ResolvedHandles;
+	UnresolvedTracker.ResolveObject(Object, ResolvedHandles);
 
-	for (auto& ChannelProperties : *ChannelToUnresolved)
+	for (auto& ChannelProperties : ResolvedHandles)
 	{
 		FChannelObjectPair& ChannelObjectPair = ChannelProperties.Key;
 		if (!ChannelObjectPair.Key.IsValid() || !ChannelObjectPair.Value.IsValid())
@@ -1305,55 +1493,35 @@ void USpatialSender::ResolveOutgoingOperations(UObject* Object, bool bIsHandover
 
 		USpatialActorChannel* DependentChannel = ChannelObjectPair.Key.Get();
 		UObject* ReplicatingObject = ChannelObjectPair.Value.Get();
-		FHandleToUnresolved& HandleToUnresolved = ChannelProperties.Value;
 
 		const FClassInfo& Info = ClassInfoManager->GetOrCreateClassInfoByObject(ReplicatingObject);
 
 		TArray<uint16> PropertyHandles;
 
-		for (auto& HandleUnresolvedPair : HandleToUnresolved)
+		for (uint16 Handle : ChannelProperties.Value)
 		{
-			uint16 Handle = HandleUnresolvedPair.Key;
-			FUnresolvedEntry& Unresolved = HandleUnresolvedPair.Value;
+			PropertyHandles.Add(Handle);
 
-			Unresolved->Remove(Object);
-			if (Unresolved->Num() == 0)
+			// Hack to figure out if this property is an array to add extra handles
+			if (!bIsHandover && DependentChannel->IsDynamicArrayHandle(ReplicatingObject, Handle))
 			{
-				PropertyHandles.Add(Handle);
-
-				// Hack to figure out if this property is an array to add extra handles
-				if (!bIsHandover && DependentChannel->IsDynamicArrayHandle(ReplicatingObject, Handle))
-				{
-					PropertyHandles.Add(0);
-					PropertyHandles.Add(0);
-				}
-
-				FHandleToUnresolved& AnotherHandleToUnresolved = PropertyToUnresolved.FindChecked(ChannelObjectPair);
-				AnotherHandleToUnresolved.Remove(Handle);
-				if (AnotherHandleToUnresolved.Num() == 0)
-				{
-					PropertyToUnresolved.Remove(ChannelObjectPair);
-				}
+				PropertyHandles.Add(0);
+				PropertyHandles.Add(0);
 			}
 		}
 
-		if (PropertyHandles.Num() > 0)
+		if (bIsHandover)
 		{
-			if (bIsHandover)
-			{
-				SendComponentUpdates(ReplicatingObject, Info, DependentChannel, nullptr, &PropertyHandles);
-			}
-			else
-			{
-				// End with zero to indicate the end of the list of handles.
-				PropertyHandles.Add(0);
-				FRepChangeState RepChangeState = { PropertyHandles, DependentChannel->GetObjectRepLayout(ReplicatingObject) };
-				SendComponentUpdates(ReplicatingObject, Info, DependentChannel, &RepChangeState, nullptr);
-			}
+			SendComponentUpdates(ReplicatingObject, Info, DependentChannel, nullptr, &PropertyHandles);
+		}
+		else
+		{
+			// End with zero to indicate the end of the list of handles.
+			PropertyHandles.Add(0);
+			FRepChangeState RepChangeState = { PropertyHandles, DependentChannel->GetObjectRepLayout(ReplicatingObject) };
+			SendComponentUpdates(ReplicatingObject, Info, DependentChannel, &RepChangeState, nullptr);
 		}
 	}
-
-	ObjectToUnresolved.Remove(Object);
 }
 
 void USpatialSender::SendOutgoingRPCs()
@@ -4,8 +4,18 @@
 #include <WorkerSDK/improbable/c_worker.h>
 
 TMap<FString, FString> USpatialWorkerFlags::WorkerFlags;
+TMap<FString, TUniquePtr<FWorkerFlag>> USpatialWorkerFlags::RegisteredWorkerFlags;
 FOnWorkerFlagsUpdated USpatialWorkerFlags::OnWorkerFlagsUpdated;
 
+void FWorkerFlag::SetValue(const FString* NewValue)
+{
+	bIsSet = NewValue != nullptr;
+	StringValue = bIsSet ? *NewValue : FString();
+	IntValue = FCString::Atoi(*StringValue);
+	FloatValue = FCString::Atof(*StringValue);
+	bBoolValue = FCString::ToBool(*StringValue);
+}
+
 bool USpatialWorkerFlags::GetWorkerFlag(const FString& Name, FString& OutValue)
 {
 	if (FString* ValuePtr = WorkerFlags.Find(Name))
@@ -17,22 +27,49 @@ bool USpatialWorkerFlags::GetWorkerFlag(const FString& Name, FString& OutValue)
 	return false;
 }
 
+FWorkerFlag& USpatialWorkerFlags::RegisterWorkerFlag(const FString& Name)
+{
+	if (TUniquePtr<FWorkerFlag>* RegisteredFlag = RegisteredWorkerFlags.Find(Name))
+	{
+		return **RegisteredFlag;
+	}
+
+	FWorkerFlag& Flag = *RegisteredWorkerFlags.Add(Name, TUniquePtr<FWorkerFlag>(new FWorkerFlag(Name)));
+	Flag.SetValue(WorkerFlags.Find(Name));
+	return Flag;
+}
+
 void USpatialWorkerFlags::ApplyWorkerFlagUpdate(const Worker_FlagUpdateOp& Op)
 {
 	FString NewName = FString(UTF8_TO_TCHAR(Op.name));
+	TUniquePtr<FWorkerFlag>* RegisteredFlag = RegisteredWorkerFlags.Find(NewName);
 
 	if (Op.value != nullptr)
 	{
 		FString NewValue = FString(UTF8_TO_TCHAR(Op.value));
 		FString& ValueFlag = WorkerFlags.FindOrAdd(NewName);
 		ValueFlag = NewValue;
+
+		if (RegisteredFlag != nullptr)
+		{
+			(*RegisteredFlag)->SetValue(&NewValue);
+			(*RegisteredFlag)->OnChanged().Broadcast(**RegisteredFlag);
+		}
+
 		OnWorkerFlagsUpdated.Broadcast(NewName, NewValue);
 	}
 	else
 	{
 		WorkerFlags.Remove(NewName);
+
+		if (RegisteredFlag != nullptr)
+		{
+			(*RegisteredFlag)->SetValue(nullptr);
+			(*RegisteredFlag)->OnChanged().Broadcast(**RegisteredFlag);
+		}
 	}
 }
+
 FOnWorkerFlagsUpdated& USpatialWorkerFlags::GetOnWorkerFlagsUpdated()
 {
 	return OnWorkerFlagsUpdated;
@@ -1,6 +1,7 @@
 // Copyright (c) Improbable Worlds Ltd, All Rights Reserved
 
 #include "SpatialGDKSettings.h"
+#include "GameFramework/Actor.h"
 #include "Improbable/SpatialEngineConstants.h"
 #include "Misc/MessageDialog.h"
 #include "Misc/CommandLine.h"
@@ -22,6 +23,11 @@ USpatialGDKSettings::USpatialGDKSettings(const FObjectInitializer& ObjectInitial
 	, OpsUpdateRate(1000.0f)
 	, bEnableHandover(true)
 	, MaxNetCullDistanceSquared(900000000.0f) // Set to twice the default Actor NetCullDistanceSquared (300m)
+	, DefaultPropertyGroupNetCullDistanceSquared(25000000.0f) // 50m
+	, bEnableClientPropertyGroupInterest(false)
+	, MaxClientResultComponentIds(4096)
+	, OpListQueueCapacity(256)
+	, bLeaveOpsInSDKWhenOpListQueueFull(true)
 	, QueuedIncomingRPCWaitTime(1.0f)
 	, bUsingQBI(true)
 	, PositionUpdateFrequency(1.0f)
@@ -30,11 +36,21 @@ USpatialGDKSettings::USpatialGDKSettings(const FObjectInitializer& ObjectInitial
 	, bEnableMetricsDisplay(false)
 	, MetricsReportRate(2.0f)
 	, bUseFrameTimeAsLoad(false)
+	, bUseBusyTimeAsLoad(true)
+	, LoadSmoothingReportCount(5)
+	, bReportSubsystemLoad(false)
 	, bCheckRPCOrder(false)
 	, bBatchSpatialPositionUpdates(true)
 	, MaxDynamicallyAttachedSubobjectsPerClass(3)
 	, bEnableServerQBI(bUsingQBI)
 	, bPackRPCs(true)
+	, bBatchRPCEvents(false)
+	, bBatchCrossServerRPCs(false)
+	, bUseRPCParameterCodecs(false)
+	, MaxRPCsOnEntityCreation(32)
+	, bParseComponentDataInParallel(true)
+	, bDeduplicateSnapshotComponents(true)
+	, bAsyncLoadNewClassesOnEntityCheckout(false)
 	, bUseDevelopmentAuthenticationFlow(false)
 	, DefaultWorkerType(FWorkerType(SpatialConstants::DefaultServerWorkerType))
 	, bEnableOffloading(false)
@@ -58,6 +74,45 @@ void USpatialGDKSettings::PostInitProperties()
 #endif
 }
 
+FPositionUpdatePolicy USpatialGDKSettings::GetPositionUpdatePolicyForClass(const UClass* Class) const
+{
+	for (const UClass* FoundClass = Class; FoundClass != nullptr && FoundClass->IsChildOf(AActor::StaticClass()); FoundClass = FoundClass->GetSuperClass())
+	{
+		if (const FPositionUpdatePolicy* Policy = PositionUpdatePolicies.Find(TSoftClassPtr<AActor>(FoundClass)))
+		{
+			return *Policy;
+		}
+	}
+
+	FPositionUpdatePolicy DefaultPolicy;
+	DefaultPolicy.DistanceThreshold = PositionDistanceThreshold;
+	DefaultPolicy.MinUpdateInterval = 1.0f / PositionUpdateFrequency;
+	return DefaultPolicy;
+}
+
+float USpatialGDKSettings::GetMinPositionUpdateInterval() const
+{
+	float MinInterval = 1.0f / PositionUpdateFrequency;
+	for (const TPair<TSoftClassPtr<AActor>, FPositionUpdatePolicy>& Policy : PositionUpdatePolicies)
+	{
+		MinInterval = FMath::Min(MinInterval, Policy.Value.MinUpdateInterval);
+	}
+	return MinInterval;
+}
+
+uint32 USpatialGDKSettings::GetClientActorPoolSizeForClass(const UClass* Class) const
+{
+	for (const UClass* FoundClass = Class; FoundClass != nullptr && FoundClass->IsChildOf(AActor::StaticClass()); FoundClass = FoundClass->GetSuperClass())
+	{
+		if (const uint32* PoolSize = ClientActorPoolSizes.Find(TSoftClassPtr<AActor>(FoundClass)))
+		{
+			return *PoolSize;
+		}
+	}
+
+	return 0;
+}
+
 #if WITH_EDITOR
 void USpatialGDKSettings::PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent)
 {
@@ -0,0 +1,141 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/ActorPool.h"
+
+#include "Components/ActorComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "TimerManager.h"
+#include "UObject/UnrealType.h"
+
+#include "SpatialGDKSettings.h"
+
+DEFINE_LOG_CATEGORY(LogSpatialActorPool);
+
+namespace
+{
+
+// Properties missing from the data of the entity that reuses the Actor, e.g. owner only or conditional ones, would otherwise keep
+// the values of the previous entity. Instanced references are skipped, as they point to the Actor's own subobjects.
+void ResetReplicatedProperties(UObject* Object, const UObject* Archetype)
+{
+	for (TFieldIterator<UProperty> It(Object->GetClass()); It; ++It)
+	{
+		UProperty* Property = *It;
+		if (Property->HasAnyPropertyFlags(CPF_Net) && !Property->HasAnyPropertyFlags(CPF_InstancedReference | CPF_ContainsInstancedReference))
+		{
+			Property->CopyCompleteValue_InContainer(Object, Archetype);
+		}
+	}
+}
+
+} // anonymous namespace
+
+bool FActorPool::CanRelease(const AActor* Actor)
+{
+	const FClassPool& ClassPool = GetClassPool(Actor->GetClass());
+	return (uint32)ClassPool.Actors.Num() < ClassPool.MaxSize;
+}
+
+void FActorPool::Release(AActor* Actor)
+{
+	check(CanRelease(Actor));
+
+	// Give game code the same chance to clean up as if the Actor was destroyed.
+	// This also uninitializes its components and unregisters it from the net driver, which Acquire undoes.
+	Actor->RouteEndPlay(EEndPlayReason::Destroyed);
+
+	if (UWorld* World = Actor->GetWorld())
+	{
+		World->GetTimerManager().ClearAllTimersForObject(Actor);
+	}
+
+	Actor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+
+	for (UActorComponent* Component : Actor->GetComponents())
+	{
+		Component->SetComponentTickEnabled(false);
+		Component->Deactivate();
+	}
+
+	GetClassPool(Actor->GetClass()).Actors.Add(Actor);
+}
+
+AActor* FActorPool::Acquire(UClass* Class, const FTransform& Transform)
+{
+	FClassPool& ClassPool = GetClassPool(Class);
+
+	while (ClassPool.Actors.Num() > 0)
+	{
+		AActor* Actor = ClassPool.Actors.Pop(/* bAllowShrinking */ false).Get();
+		if (Actor == nullptr || Actor->IsPendingKill())
+		{
+			// Destroyed by something else, e.g. its level being unloaded.
+			continue;
+		}
+
+		if (Actor->HasActorBegunPlay())
+		{
+			// An EndPlay override didn't call Super, so the Actor would never get BeginPlay again.
+			UE_LOG(LogSpatialActorPool, Warning, TEXT("Pooled Actor %s still has begun play after EndPlay, destroying it instead of reusing it."), *Actor->GetName());
+			Actor->Destroy(true);
+			continue;
+		}
+
+		// Restore the state a newly spawned Actor would have.
+		const AActor* DefaultActor = Class->GetDefaultObject<AActor>();
+		ResetReplicatedProperties(Actor, DefaultActor);
+
+		Actor->SetActorTransform(Transform, /* bSweep */ false, nullptr, ETeleportType::ResetPhysics);
+		Actor->SetActorHiddenInGame(DefaultActor->bHidden);
+		Actor->SetActorEnableCollision(DefaultActor->GetActorEnableCollision());
+		Actor->SetActorTickEnabled(DefaultActor->PrimaryActorTick.bStartWithTickEnabled);
+
+		for (UActorComponent* Component : Actor->GetComponents())
+		{
+			if (const UActorComponent* DefaultComponent = Cast<UActorComponent>(Component->GetArchetype()))
+			{
+				if (Component->GetIsReplicated())
+				{
+					ResetReplicatedProperties(Component, DefaultComponent);
+				}
+
+				Component->SetComponentTickEnabled(DefaultComponent->PrimaryComponentTick.bStartWithTickEnabled);
+			}
+
+			if (Component->bAutoActivate)
+			{
+				Component->Activate(/* bReset */ true);
+			}
+		}
+
+		// Go through the same initialization as a newly spawned Actor. BeginPlay is dispatched once the entity's initial state is applied.
+		Actor->PreInitializeComponents();
+		Actor->InitializeComponents();
+		Actor->PostInitializeComponents();
+
+		if (UWorld* World = Actor->GetWorld())
+		{
+			World->AddNetworkActor(Actor);
+		}
+
+		return Actor;
+	}
+
+	return nullptr;
+}
+
+FActorPool::FClassPool& FActorPool::GetClassPool(const UClass* Class)
+{
+	if (FClassPool* ClassPool = ClassPools.Find(Class))
+	{
+		return *ClassPool;
+	}
+
+	FClassPool& ClassPool = ClassPools.Add(Class);
+	ClassPool.MaxSize = GetDefault<USpatialGDKSettings>()->GetClientActorPoolSizeForClass(Class);
+	return ClassPool;
+}
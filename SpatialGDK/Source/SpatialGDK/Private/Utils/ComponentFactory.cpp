@@ -16,6 +16,17 @@
 #include "Utils/RepLayoutUtils.h"
 #include "Utils/InterestFactory.h"
 
+namespace
+{
+
+// Returns ComponentId if it holds one of the Actor's property groups, INVALID_COMPONENT_ID for the regular data components.
+Worker_ComponentId GetPropertyGroupComponent(const FClassInfo& Info, Worker_ComponentId ComponentId)
+{
+	return Info.PropertyGroupComponents.Contains(ComponentId) ? ComponentId : SpatialConstants::INVALID_COMPONENT_ID;
+}
+
+} // anonymous namespace
+
 namespace SpatialGDK
 {
 
@@ -28,7 +39,7 @@ ComponentFactory::ComponentFactory(FUnresolvedObjectsMap& RepUnresolvedObjectsMa
 	, bInterestHasChanged(bInterestDirty)
 { }
 
-bool ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObject* Object, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, bool bIsInitialData, TArray<Schema_FieldId>* ClearedIds /*= nullptr*/)
+bool ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObject* Object, const FClassInfo& Info, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, Worker_ComponentId PropertyGroupComponent, bool bIsInitialData, TArray<Schema_FieldId>* ClearedIds /*= nullptr*/)
 {
 	bool bWroteSomething = false;
 
@@ -42,10 +53,11 @@ bool ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObject*
 			const FRepLayoutCmd& Cmd = Changes.RepLayout.Cmds[HandleIterator.CmdIndex];
 			const FRepParentCmd& Parent = Changes.RepLayout.Parents[Cmd.ParentIndex];
 
-			if (GetGroupFromCondition(Parent.Condition) == PropertyGroup)
+			if (GetGroupFromCondition(Parent.Condition) == PropertyGroup && Info.GetPropertyGroupComponent(HandleIterator.Handle) == PropertyGroupComponent)
 			{
 				const uint8* Data = (uint8*)Object + Cmd.Offset;
-				TSet<TWeakObjectPtr<const UObject>> UnresolvedObjects;
+				FUnresolvedObjectsSet& UnresolvedObjects = UnresolvedObjectsScratch;
+				UnresolvedObjects.Reset();
 
 				bool bProcessedFastArrayProperty = false;
 
@@ -85,7 +97,7 @@ bool ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObject*
 						Schema_ClearField(ComponentObject, HandleIterator.Handle);
 					}
 
-					PendingRepUnresolvedObjectsMap.Add(HandleIterator.Handle, UnresolvedObjects);
+					PendingRepUnresolvedObjectsMap.Add(HandleIterator.Handle, MoveTemp(UnresolvedObjects));
 				}
 			}
 
@@ -112,7 +124,8 @@ bool ComponentFactory::FillHandoverSchemaObject(Schema_Object* ComponentObject,
 		const FHandoverPropertyInfo& PropertyInfo = Info.HandoverProperties[ChangedHandle - 1];
 
 		const uint8* Data = (uint8*)Object + PropertyInfo.Offset;
-		FUnresolvedObjectsSet UnresolvedObjects;
+		FUnresolvedObjectsSet& UnresolvedObjects = UnresolvedObjectsScratch;
+		UnresolvedObjects.Reset();
 
 		AddProperty(ComponentObject, ChangedHandle, PropertyInfo.Property, Data, UnresolvedObjects, ClearedIds);
 
@@ -129,14 +142,14 @@ bool ComponentFactory::FillHandoverSchemaObject(Schema_Object* ComponentObject,
 				Schema_ClearField(ComponentObject, ChangedHandle);
 			}
 
-			PendingHandoverUnresolvedObjectsMap.Add(ChangedHandle, UnresolvedObjects);
+			PendingHandoverUnresolvedObjectsMap.Add(ChangedHandle, MoveTemp(UnresolvedObjects));
 		}
 	}
 
 	return bWroteSomething;
 }
 
-void ComponentFactory::AddProperty(Schema_Object* Object, Schema_FieldId FieldId, UProperty* Property, const uint8* Data, TSet<TWeakObjectPtr<const UObject>>& UnresolvedObjects, TArray<Schema_FieldId>* ClearedIds)
+void ComponentFactory::AddProperty(Schema_Object* Object, Schema_FieldId FieldId, UProperty* Property, const uint8* Data, FUnresolvedObjectsSet& UnresolvedObjects, TArray<Schema_FieldId>* ClearedIds)
 {
 	if (UStructProperty* StructProperty = Cast<UStructProperty>(Property))
 	{
@@ -326,12 +339,17 @@ TArray<Worker_ComponentData> ComponentFactory::CreateComponentDatas(UObject* Obj
 
 	if (Info.SchemaComponents[SCHEMA_Data] != SpatialConstants::INVALID_COMPONENT_ID)
 	{
-		ComponentDatas.Add(CreateComponentData(Info.SchemaComponents[SCHEMA_Data], Object, RepChangeState, SCHEMA_Data));
+		ComponentDatas.Add(CreateComponentData(Info.SchemaComponents[SCHEMA_Data], Object, Info, RepChangeState, SCHEMA_Data));
 	}
 
 	if (Info.SchemaComponents[SCHEMA_OwnerOnly] != SpatialConstants::INVALID_COMPONENT_ID)
 	{
-		ComponentDatas.Add(CreateComponentData(Info.SchemaComponents[SCHEMA_OwnerOnly], Object, RepChangeState, SCHEMA_OwnerOnly));
+		ComponentDatas.Add(CreateComponentData(Info.SchemaComponents[SCHEMA_OwnerOnly], Object, Info, RepChangeState, SCHEMA_OwnerOnly));
+	}
+
+	for (Worker_ComponentId PropertyGroupComponent : Info.PropertyGroupComponents)
+	{
+		ComponentDatas.Add(CreateComponentData(PropertyGroupComponent, Object, Info, RepChangeState, SCHEMA_Data));
 	}
 
 	if (Info.SchemaComponents[SCHEMA_Handover] != SpatialConstants::INVALID_COMPONENT_ID)
@@ -342,7 +360,7 @@ TArray<Worker_ComponentData> ComponentFactory::CreateComponentDatas(UObject* Obj
 	return ComponentDatas;
 }
 
-Worker_ComponentData ComponentFactory::CreateComponentData(Worker_ComponentId ComponentId, UObject* Object, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup)
+Worker_ComponentData ComponentFactory::CreateComponentData(Worker_ComponentId ComponentId, UObject* Object, const FClassInfo& Info, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup)
 {
 	Worker_ComponentData ComponentData = {};
 	ComponentData.component_id = ComponentId;
@@ -351,7 +369,7 @@ Worker_ComponentData ComponentFactory::CreateComponentData(Worker_ComponentId Co
 
 	// We're currently ignoring ClearedId fields, which is problematic if the initial replicated state
 	// is different to what the default state is (the client will have the incorrect data). UNR:959
-	FillSchemaObject(ComponentObject, Object, Changes, PropertyGroup, true);
+	FillSchemaObject(ComponentObject, Object, Info, Changes, PropertyGroup, GetPropertyGroupComponent(Info, ComponentId), true);
 
 	return ComponentData;
 }
@@ -384,7 +402,7 @@ TArray<Worker_ComponentUpdate> ComponentFactory::CreateComponentUpdates(UObject*
 		if (Info.SchemaComponents[SCHEMA_Data] != SpatialConstants::INVALID_COMPONENT_ID)
 		{
 			bool bWroteSomething = false;
-			Worker_ComponentUpdate MultiClientUpdate = CreateComponentUpdate(Info.SchemaComponents[SCHEMA_Data], Object, *RepChangeState, SCHEMA_Data, bWroteSomething);
+			Worker_ComponentUpdate MultiClientUpdate = CreateComponentUpdate(Info.SchemaComponents[SCHEMA_Data], Object, Info, *RepChangeState, SCHEMA_Data, bWroteSomething);
 			if (bWroteSomething)
 			{
 				ComponentUpdates.Add(MultiClientUpdate);
@@ -394,12 +412,22 @@ TArray<Worker_ComponentUpdate> ComponentFactory::CreateComponentUpdates(UObject*
 		if (Info.SchemaComponents[SCHEMA_OwnerOnly] != SpatialConstants::INVALID_COMPONENT_ID)
 		{
 			bool bWroteSomething = false;
-			Worker_ComponentUpdate SingleClientUpdate = CreateComponentUpdate(Info.SchemaComponents[SCHEMA_OwnerOnly], Object, *RepChangeState, SCHEMA_OwnerOnly, bWroteSomething);
+			Worker_ComponentUpdate SingleClientUpdate = CreateComponentUpdate(Info.SchemaComponents[SCHEMA_OwnerOnly], Object, Info, *RepChangeState, SCHEMA_OwnerOnly, bWroteSomething);
 			if (bWroteSomething)
 			{
 				ComponentUpdates.Add(SingleClientUpdate);
 			}
 		}
+
+		for (Worker_ComponentId PropertyGroupComponent : Info.PropertyGroupComponents)
+		{
+			bool bWroteSomething = false;
+			Worker_ComponentUpdate PropertyGroupUpdate = CreateComponentUpdate(PropertyGroupComponent, Object, Info, *RepChangeState, SCHEMA_Data, bWroteSomething);
+			if (bWroteSomething)
+			{
+				ComponentUpdates.Add(PropertyGroupUpdate);
+			}
+		}
 	}
 
 	if (HandoverChangeState)
@@ -425,7 +453,7 @@ TArray<Worker_ComponentUpdate> ComponentFactory::CreateComponentUpdates(UObject*
 	return ComponentUpdates;
 }
 
-Worker_ComponentUpdate ComponentFactory::CreateComponentUpdate(Worker_ComponentId ComponentId, UObject* Object, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, bool& bWroteSomething)
+Worker_ComponentUpdate ComponentFactory::CreateComponentUpdate(Worker_ComponentId ComponentId, UObject* Object, const FClassInfo& Info, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, bool& bWroteSomething)
 {
 	Worker_ComponentUpdate ComponentUpdate = {};
 
@@ -435,7 +463,7 @@ Worker_ComponentUpdate ComponentFactory::CreateComponentUpdate(Worker_ComponentI
 
 	TArray<Schema_FieldId> ClearedIds;
 
-	bWroteSomething = FillSchemaObject(ComponentObject, Object, Changes, PropertyGroup, false, &ClearedIds);
+	bWroteSomething = FillSchemaObject(ComponentObject, Object, Info, Changes, PropertyGroup, GetPropertyGroupComponent(Info, ComponentId), false, &ClearedIds);
 
 	for (Schema_FieldId Id : ClearedIds)
 	{
@@ -0,0 +1,261 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/ComponentParser.h"
+
+#include "Net/RepLayout.h"
+#include "UObject/TextProperty.h"
+
+#include "Interop/SpatialClassInfoManager.h"
+#include "Utils/RepLayoutUtils.h"
+#include "Utils/SchemaUtils.h"
+
+namespace SpatialGDK
+{
+
+namespace
+{
+
+uint32 GetPropertyCount(const Schema_Object* Object, Schema_FieldId FieldId, UProperty* Property)
+{
+	if (UStructProperty* StructProperty = Cast<UStructProperty>(Property))
+	{
+		return Schema_GetBytesCount(Object, FieldId);
+	}
+	else if (UBoolProperty* BoolProperty = Cast<UBoolProperty>(Property))
+	{
+		return Schema_GetBoolCount(Object, FieldId);
+	}
+	else if (UFloatProperty* FloatProperty = Cast<UFloatProperty>(Property))
+	{
+		return Schema_GetFloatCount(Object, FieldId);
+	}
+	else if (UDoubleProperty* DoubleProperty = Cast<UDoubleProperty>(Property))
+	{
+		return Schema_GetDoubleCount(Object, FieldId);
+	}
+	else if (UInt8Property* Int8Property = Cast<UInt8Property>(Property))
+	{
+		return Schema_GetInt32Count(Object, FieldId);
+	}
+	else if (UInt16Property* Int16Property = Cast<UInt16Property>(Property))
+	{
+		return Schema_GetInt32Count(Object, FieldId);
+	}
+	else if (UIntProperty* IntProperty = Cast<UIntProperty>(Property))
+	{
+		return Schema_GetInt32Count(Object, FieldId);
+	}
+	else if (UInt64Property* Int64Property = Cast<UInt64Property>(Property))
+	{
+		return Schema_GetInt64Count(Object, FieldId);
+	}
+	else if (UByteProperty* ByteProperty = Cast<UByteProperty>(Property))
+	{
+		return Schema_GetUint32Count(Object, FieldId);
+	}
+	else if (UUInt16Property* UInt16Property = Cast<UUInt16Property>(Property))
+	{
+		return Schema_GetUint32Count(Object, FieldId);
+	}
+	else if (UUInt32Property* UInt32Property = Cast<UUInt32Property>(Property))
+	{
+		return Schema_GetUint32Count(Object, FieldId);
+	}
+	else if (UUInt64Property* UInt64Property = Cast<UUInt64Property>(Property))
+	{
+		return Schema_GetUint64Count(Object, FieldId);
+	}
+	else if (UObjectPropertyBase* ObjectProperty = Cast<UObjectPropertyBase>(Property))
+	{
+		return Schema_GetObjectCount(Object, FieldId);
+	}
+	else if (UNameProperty* NameProperty = Cast<UNameProperty>(Property))
+	{
+		return Schema_GetBytesCount(Object, FieldId);
+	}
+	else if (UStrProperty* StrProperty = Cast<UStrProperty>(Property))
+	{
+		return Schema_GetBytesCount(Object, FieldId);
+	}
+	else if (UTextProperty* TextProperty = Cast<UTextProperty>(Property))
+	{
+		return Schema_GetBytesCount(Object, FieldId);
+	}
+	else if (UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property))
+	{
+		return GetPropertyCount(Object, FieldId, ArrayProperty->Inner);
+	}
+	else if (UEnumProperty* EnumProperty = Cast<UEnumProperty>(Property))
+	{
+		if (EnumProperty->ElementSize < 4)
+		{
+			return Schema_GetUint32Count(Object, FieldId);
+		}
+		else
+		{
+			return GetPropertyCount(Object, FieldId, EnumProperty->GetUnderlyingProperty());
+		}
+	}
+	else
+	{
+		checkf(false, TEXT("Tried to get count of unknown property in field %d"), FieldId);
+		return 0;
+	}
+}
+
+void ParseProperty(Schema_Object* Object, Schema_FieldId FieldId, uint32 Index, UProperty* Property, ParsedSchemaField& OutField)
+{
+	if (UStructProperty* StructProperty = Cast<UStructProperty>(Property))
+	{
+		OutField.Bytes.Add(IndexBytesFromSchema(Object, FieldId, Index));
+	}
+	else if (UBoolProperty* BoolProperty = Cast<UBoolProperty>(Property))
+	{
+		OutField.Integers.Add(Schema_IndexBool(Object, FieldId, Index) != 0);
+	}
+	else if (UFloatProperty* FloatProperty = Cast<UFloatProperty>(Property))
+	{
+		OutField.Reals.Add(Schema_IndexFloat(Object, FieldId, Index));
+	}
+	else if (UDoubleProperty* DoubleProperty = Cast<UDoubleProperty>(Property))
+	{
+		OutField.Reals.Add(Schema_IndexDouble(Object, FieldId, Index));
+	}
+	else if (UInt8Property* Int8Property = Cast<UInt8Property>(Property))
+	{
+		OutField.Integers.Add(Schema_IndexInt32(Object, FieldId, Index));
+	}
+	else if (UInt16Property* Int16Property = Cast<UInt16Property>(Property))
+	{
+		OutField.Integers.Add(Schema_IndexInt32(Object, FieldId, Index));
+	}
+	else if (UIntProperty* IntProperty = Cast<UIntProperty>(Property))
+	{
+		OutField.Integers.Add(Schema_IndexInt32(Object, FieldId, Index));
+	}
+	else if (UInt64Property* Int64Property = Cast<UInt64Property>(Property))
+	{
+		OutField.Integers.Add(Schema_IndexInt64(Object, FieldId, Index));
+	}
+	else if (UByteProperty* ByteProperty = Cast<UByteProperty>(Property))
+	{
+		OutField.Integers.Add(Schema_IndexUint32(Object, FieldId, Index));
+	}
+	else if (UUInt16Property* UInt16Property = Cast<UUInt16Property>(Property))
+	{
+		OutField.Integers.Add(Schema_IndexUint32(Object, FieldId, Index));
+	}
+	else if (UUInt32Property* UInt32Property = Cast<UUInt32Property>(Property))
+	{
+		OutField.Integers.Add(Schema_IndexUint32(Object, FieldId, Index));
+	}
+	else if (UUInt64Property* UInt64Property = Cast<UUInt64Property>(Property))
+	{
+		OutField.Integers.Add((int64)Schema_IndexUint64(Object, FieldId, Index));
+	}
+	else if (UObjectPropertyBase* ObjectProperty = Cast<UObjectPropertyBase>(Property))
+	{
+		OutField.ObjectRefs.Add(IndexObjectRefFromSchema(Object, FieldId, Index));
+	}
+	else if (UNameProperty* NameProperty = Cast<UNameProperty>(Property))
+	{
+		OutField.Strings.Add(IndexStringFromSchema(Object, FieldId, Index));
+	}
+	else if (UStrProperty* StrProperty = Cast<UStrProperty>(Property))
+	{
+		OutField.Strings.Add(IndexStringFromSchema(Object, FieldId, Index));
+	}
+	else if (UTextProperty* TextProperty = Cast<UTextProperty>(Property))
+	{
+		OutField.Strings.Add(IndexStringFromSchema(Object, FieldId, Index));
+	}
+	else if (UEnumProperty* EnumProperty = Cast<UEnumProperty>(Property))
+	{
+		if (EnumProperty->ElementSize < 4)
+		{
+			OutField.Integers.Add(Schema_IndexUint32(Object, FieldId, Index));
+		}
+		else
+		{
+			ParseProperty(Object, FieldId, Index, EnumProperty->GetUnderlyingProperty(), OutField);
+		}
+	}
+	else
+	{
+		checkf(false, TEXT("Tried to read unknown property in field %d"), FieldId);
+	}
+}
+
+void ParseArray(Schema_Object* Object, Schema_FieldId FieldId, UArrayProperty* Property, ParsedSchemaField& OutField)
+{
+	uint32 Count = GetPropertyCount(Object, FieldId, Property->Inner);
+	for (uint32 i = 0; i < Count; i++)
+	{
+		ParseProperty(Object, FieldId, i, Property->Inner, OutField);
+	}
+}
+
+} // anonymous namespace
+
+void ParseSchemaObject(Schema_Object* ComponentObject, const TArray<Schema_FieldId>& FieldIds, const FRepLayout& RepLayout, ParsedComponentData& OutParsedData)
+{
+	const TArray<FRepLayoutCmd>& Cmds = RepLayout.Cmds;
+	const TArray<FHandleToCmdIndex>& BaseHandleToCmdIndex = RepLayout.BaseHandleToCmdIndex;
+
+	OutParsedData.Fields.Reserve(FieldIds.Num());
+
+	for (Schema_FieldId FieldId : FieldIds)
+	{
+		// FieldId is the same as rep handle
+		check(FieldId > 0 && (int)FieldId - 1 < BaseHandleToCmdIndex.Num());
+		const FRepLayoutCmd& Cmd = Cmds[BaseHandleToCmdIndex[FieldId - 1].CmdIndex];
+
+		ParsedSchemaField& Field = OutParsedData.Fields.AddDefaulted_GetRef();
+		Field.FieldId = FieldId;
+
+		if (Cmd.Type == ERepLayoutCmdType::DynamicArray)
+		{
+			UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Cmd.Property);
+
+			// FastArraySerializer arrays are delta serialized as a whole, so we keep the payload as is
+			if (GetFastArraySerializerProperty(ArrayProperty) != nullptr)
+			{
+				Field.Bytes.Add(GetBytesFromSchema(ComponentObject, FieldId));
+			}
+			else
+			{
+				ParseArray(ComponentObject, FieldId, ArrayProperty, Field);
+			}
+		}
+		else
+		{
+			ParseProperty(ComponentObject, FieldId, 0, Cmd.Property, Field);
+		}
+	}
+}
+
+void ParseHandoverSchemaObject(Schema_Object* ComponentObject, const TArray<Schema_FieldId>& FieldIds, const FClassInfo& ClassInfo, ParsedComponentData& OutParsedData)
+{
+	OutParsedData.Fields.Reserve(FieldIds.Num());
+
+	for (Schema_FieldId FieldId : FieldIds)
+	{
+		// FieldId is the same as handover handle
+		check(FieldId > 0 && (int)FieldId - 1 < ClassInfo.HandoverProperties.Num());
+		const FHandoverPropertyInfo& PropertyInfo = ClassInfo.HandoverProperties[FieldId - 1];
+
+		ParsedSchemaField& Field = OutParsedData.Fields.AddDefaulted_GetRef();
+		Field.FieldId = FieldId;
+
+		if (UArrayProperty* ArrayProperty = Cast<UArrayProperty>(PropertyInfo.Property))
+		{
+			ParseArray(ComponentObject, FieldId, ArrayProperty, Field);
+		}
+		else
+		{
+			ParseProperty(ComponentObject, FieldId, 0, PropertyInfo.Property, Field);
+		}
+	}
+}
+
+} // namespace SpatialGDK
@@ -41,17 +41,23 @@ void ComponentReader::ApplyComponentData(const Worker_ComponentData& ComponentDa
 	UpdatedIds.SetNumUninitialized(Schema_GetUniqueFieldIdCount(ComponentObject));
 	Schema_GetUniqueFieldIds(ComponentObject, UpdatedIds.GetData());
 
-	if (bIsHandover)
-	{
-		ApplyHandoverSchemaObject(ComponentObject, Object, Channel, true, UpdatedIds);
-	}
-	else
+	ParsedComponentData ParsedData;
+	ParseComponentObject(ComponentObject, Object, bIsHandover, UpdatedIds, ParsedData);
+
+	ApplyParsedData(ParsedData, Object, Channel, bIsHandover, true);
+}
+
+void ComponentReader::ApplyParsedComponentData(ParsedComponentData& ParsedData, UObject* Object, USpatialActorChannel* Channel, bool bIsHandover)
+{
+	if (Object->IsPendingKill())
 	{
-		ApplySchemaObject(ComponentObject, Object, Channel, true, UpdatedIds);
+		return;
 	}
+
+	ApplyParsedData(ParsedData, Object, Channel, bIsHandover, true);
 }
 
-void ComponentReader::ApplyComponentUpdate(const Worker_ComponentUpdate& ComponentUpdate, UObject* Object, USpatialActorChannel* Channel, bool bIsHandover)
+void ComponentReader::ApplyComponentUpdate(const Worker_ComponentUpdate& ComponentUpdate, UObject* Object, USpatialActorChannel* Channel, bool bIsHandover, ParsedComponentData& ScratchParsedData)
 {
 	if (Object->IsPendingKill())
 	{
@@ -75,18 +81,38 @@ void ComponentReader::ApplyComponentUpdate(const Worker_ComponentUpdate& Compone
 
 	if (UpdatedIds.Num() > 0)
 	{
-		if (bIsHandover)
-		{
-			ApplyHandoverSchemaObject(ComponentObject, Object, Channel, false, UpdatedIds);
-		}
-		else
-		{
-			ApplySchemaObject(ComponentObject, Object, Channel, false, UpdatedIds);
-		}
+		ScratchParsedData.Reset();
+		ParseComponentObject(ComponentObject, Object, bIsHandover, UpdatedIds, ScratchParsedData);
+
+		ApplyParsedData(ScratchParsedData, Object, Channel, bIsHandover, false);
+	}
+}
+
+void ComponentReader::ParseComponentObject(Schema_Object* ComponentObject, UObject* Object, bool bIsHandover, const TArray<Schema_FieldId>& UpdatedIds, ParsedComponentData& OutParsedData)
+{
+	if (bIsHandover)
+	{
+		ParseHandoverSchemaObject(ComponentObject, UpdatedIds, ClassInfoManager->GetOrCreateClassInfoByClass(Object->GetClass()), OutParsedData);
+	}
+	else
+	{
+		ParseSchemaObject(ComponentObject, UpdatedIds, *NetDriver->GetObjectClassRepLayout(Object->GetClass()), OutParsedData);
 	}
 }
 
-void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject* Object, USpatialActorChannel* Channel, bool bIsInitialData, TArray<Schema_FieldId>& UpdatedIds)
+void ComponentReader::ApplyParsedData(ParsedComponentData& ParsedData, UObject* Object, USpatialActorChannel* Channel, bool bIsHandover, bool bIsInitialData)
+{
+	if (bIsHandover)
+	{
+		ApplyHandoverSchemaObject(ParsedData, Object, Channel);
+	}
+	else
+	{
+		ApplySchemaObject(ParsedData, Object, Channel, bIsInitialData);
+	}
+}
+
+void ComponentReader::ApplySchemaObject(ParsedComponentData& ParsedData, UObject* Object, USpatialActorChannel* Channel, bool bIsInitialData)
 {
 	FObjectReplicator& Replicator = Channel->PreReceiveSpatialUpdate(Object);
 
@@ -107,8 +133,10 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject*
 
 	TArray<UProperty*> RepNotifies;
 
-	for (uint32 FieldId : UpdatedIds)
+	for (ParsedSchemaField& Field : ParsedData.Fields)
 	{
+		uint32 FieldId = Field.FieldId;
+
 		// FieldId is the same as rep handle
 		check(FieldId > 0 && (int)FieldId - 1 < BaseHandleToCmdIndex.Num());
 		int32 CmdIndex = BaseHandleToCmdIndex[FieldId - 1].CmdIndex;
@@ -133,7 +161,7 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject*
 				// Check if this is a FastArraySerializer array and if so, call our custom delta serialization
 				if (UScriptStruct* NetDeltaStruct = GetFastArraySerializerProperty(ArrayProperty))
 				{
-					TArray<uint8> ValueData = GetBytesFromSchema(ComponentObject, FieldId);
+					TArray<uint8>& ValueData = Field.Bytes[0];
 					int64 CountBits = ValueData.Num() * 8;
 					TSet<FUnrealObjectRef> NewUnresolvedRefs;
 					FSpatialNetBitReader ValueDataReader(PackageMap, ValueData.GetData(), CountBits, NewUnresolvedRefs);
@@ -155,12 +183,12 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject*
 				}
 				else
 				{
-					ApplyArray(ComponentObject, FieldId, RootObjectReferencesMap, ArrayProperty, Data, SwappedCmd.Offset, ShadowOffset, Cmd.ParentIndex);
+					ApplyArray(Field, RootObjectReferencesMap, ArrayProperty, Data, SwappedCmd.Offset, ShadowOffset, Cmd.ParentIndex);
 				}
 			}
 			else
 			{
-				ApplyProperty(ComponentObject, FieldId, RootObjectReferencesMap, 0, Cmd.Property, Data, SwappedCmd.Offset, ShadowOffset, Cmd.ParentIndex);
+				ApplyProperty(Field, RootObjectReferencesMap, 0, Cmd.Property, Data, SwappedCmd.Offset, ShadowOffset, Cmd.ParentIndex);
 			}
 
 			if (Cmd.Property->GetFName() == NAME_RemoteRole)
@@ -208,38 +236,38 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject*
 	Channel->PostReceiveSpatialUpdate(Object, RepNotifies);
 }
 
-void ComponentReader::ApplyHandoverSchemaObject(Schema_Object* ComponentObject, UObject* Object, USpatialActorChannel* Channel, bool bIsInitialData, TArray<Schema_FieldId>& UpdatedIds)
+void ComponentReader::ApplyHandoverSchemaObject(ParsedComponentData& ParsedData, UObject* Object, USpatialActorChannel* Channel)
 {
 	const FClassInfo& ClassInfo = ClassInfoManager->GetOrCreateClassInfoByClass(Object->GetClass());
 
 	Channel->PreReceiveSpatialUpdate(Object);
 
-	for (uint32 FieldId : UpdatedIds)
+	for (ParsedSchemaField& Field : ParsedData.Fields)
 	{
 		// FieldId is the same as handover handle
-		check(FieldId > 0 && (int)FieldId - 1 < ClassInfo.HandoverProperties.Num());
-		const FHandoverPropertyInfo& PropertyInfo = ClassInfo.HandoverProperties[FieldId - 1];
+		check(Field.FieldId > 0 && (int)Field.FieldId - 1 < ClassInfo.HandoverProperties.Num());
+		const FHandoverPropertyInfo& PropertyInfo = ClassInfo.HandoverProperties[Field.FieldId - 1];
 
 		uint8* Data = (uint8*)Object + PropertyInfo.Offset;
 
 		if (UArrayProperty* ArrayProperty = Cast<UArrayProperty>(PropertyInfo.Property))
 		{
-			ApplyArray(ComponentObject, FieldId, RootObjectReferencesMap, ArrayProperty, Data, PropertyInfo.Offset, -1, -1);
+			ApplyArray(Field, RootObjectReferencesMap, ArrayProperty, Data, PropertyInfo.Offset, -1, -1);
 		}
 		else
 		{
-			ApplyProperty(ComponentObject, FieldId, RootObjectReferencesMap, 0, PropertyInfo.Property, Data, PropertyInfo.Offset, -1, -1);
+			ApplyProperty(Field, RootObjectReferencesMap, 0, PropertyInfo.Property, Data, PropertyInfo.Offset, -1, -1);
 		}
 	}
 
 	Channel->PostReceiveSpatialUpdate(Object, TArray<UProperty*>());
 }
 
-void ComponentReader::ApplyProperty(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, uint32 Index, UProperty* Property, uint8* Data, int32 Offset, int32 ShadowOffset, int32 ParentIndex)
+void ComponentReader::ApplyProperty(ParsedSchemaField& Field, FObjectReferencesMap& InObjectReferencesMap, uint32 Index, UProperty* Property, uint8* Data, int32 Offset, int32 ShadowOffset, int32 ParentIndex)
 {
 	if (UStructProperty* StructProperty = Cast<UStructProperty>(Property))
 	{
-		TArray<uint8> ValueData = IndexBytesFromSchema(Object, FieldId, Index);
+		TArray<uint8>& ValueData = Field.Bytes[Index];
 		// A bit hacky, we should probably include the number of bits with the data instead.
 		int64 CountBits = ValueData.Num() * 8;
 		TSet<FUnrealObjectRef> NewUnresolvedRefs;
@@ -260,51 +288,51 @@ void ComponentReader::ApplyProperty(Schema_Object* Object, Schema_FieldId FieldI
 	}
 	else if (UBoolProperty* BoolProperty = Cast<UBoolProperty>(Property))
 	{
-		BoolProperty->SetPropertyValue(Data, Schema_IndexBool(Object, FieldId, Index) != 0);
+		BoolProperty->SetPropertyValue(Data, Field.Integers[Index] != 0);
 	}
 	else if (UFloatProperty* FloatProperty = Cast<UFloatProperty>(Property))
 	{
-		FloatProperty->SetPropertyValue(Data, Schema_IndexFloat(Object, FieldId, Index));
+		FloatProperty->SetPropertyValue(Data, (float)Field.Reals[Index]);
 	}
 	else if (UDoubleProperty* DoubleProperty = Cast<UDoubleProperty>(Property))
 	{
-		DoubleProperty->SetPropertyValue(Data, Schema_IndexDouble(Object, FieldId, Index));
+		DoubleProperty->SetPropertyValue(Data, Field.Reals[Index]);
 	}
 	else if (UInt8Property* Int8Property = Cast<UInt8Property>(Property))
 	{
-		Int8Property->SetPropertyValue(Data, (int8)Schema_IndexInt32(Object, FieldId, Index));
+		Int8Property->SetPropertyValue(Data, (int8)Field.Integers[Index]);
 	}
 	else if (UInt16Property* Int16Property = Cast<UInt16Property>(Property))
 	{
-		Int16Property->SetPropertyValue(Data, (int16)Schema_IndexInt32(Object, FieldId, Index));
+		Int16Property->SetPropertyValue(Data, (int16)Field.Integers[Index]);
 	}
 	else if (UIntProperty* IntProperty = Cast<UIntProperty>(Property))
 	{
-		IntProperty->SetPropertyValue(Data, Schema_IndexInt32(Object, FieldId, Index));
+		IntProperty->SetPropertyValue(Data, (int32)Field.Integers[Index]);
 	}
 	else if (UInt64Property* Int64Property = Cast<UInt64Property>(Property))
 	{
-		Int64Property->SetPropertyValue(Data, Schema_IndexInt64(Object, FieldId, Index));
+		Int64Property->SetPropertyValue(Data, Field.Integers[Index]);
 	}
 	else if (UByteProperty* ByteProperty = Cast<UByteProperty>(Property))
 	{
-		ByteProperty->SetPropertyValue(Data, (uint8)Schema_IndexUint32(Object, FieldId, Index));
+		ByteProperty->SetPropertyValue(Data, (uint8)Field.Integers[Index]);
 	}
 	else if (UUInt16Property* UInt16Property = Cast<UUInt16Property>(Property))
 	{
-		UInt16Property->SetPropertyValue(Data, (uint16)Schema_IndexUint32(Object, FieldId, Index));
+		UInt16Property->SetPropertyValue(Data, (uint16)Field.Integers[Index]);
 	}
 	else if (UUInt32Property* UInt32Property = Cast<UUInt32Property>(Property))
 	{
-		UInt32Property->SetPropertyValue(Data, Schema_IndexUint32(Object, FieldId, Index));
+		UInt32Property->SetPropertyValue(Data, (uint32)Field.Integers[Index]);
 	}
 	else if (UUInt64Property* UInt64Property = Cast<UUInt64Property>(Property))
 	{
-		UInt64Property->SetPropertyValue(Data, Schema_IndexUint64(Object, FieldId, Index));
+		UInt64Property->SetPropertyValue(Data, (uint64)Field.Integers[Index]);
 	}
 	else if (UObjectPropertyBase* ObjectProperty = Cast<UObjectPropertyBase>(Property))
 	{
-		FUnrealObjectRef ObjectRef = IndexObjectRefFromSchema(Object, FieldId, Index);
+		const FUnrealObjectRef& ObjectRef = Field.ObjectRefs[Index];
 		check(ObjectRef != FUnrealObjectRef::UNRESOLVED_OBJECT_REF);
 		bool bUnresolved = false;
 
@@ -315,7 +343,8 @@ void ComponentReader::ApplyProperty(Schema_Object* Object, Schema_FieldId FieldI
 		else
 		{
 			FNetworkGUID NetGUID = PackageMap->GetNetGUIDFromUnrealObjectRef(ObjectRef);
-			if (NetGUID.IsValid())
+			// Stably named objects whose package is still loading are treated like unresolved entities until it has loaded.
+			if (NetGUID.IsValid() && !PackageMap->TryAsyncLoadStablyNamedObject(NetGUID, ObjectRef))
 			{
 				UObject* ObjectValue = PackageMap->GetObjectFromNetGUID(NetGUID, true);
 				if (ObjectValue == nullptr)
@@ -350,34 +379,34 @@ void ComponentReader::ApplyProperty(Schema_Object* Object, Schema_FieldId FieldI
 	}
 	else if (UNameProperty* NameProperty = Cast<UNameProperty>(Property))
 	{
-		NameProperty->SetPropertyValue(Data, FName(*IndexStringFromSchema(Object, FieldId, Index)));
+		NameProperty->SetPropertyValue(Data, FName(*Field.Strings[Index]));
 	}
 	else if (UStrProperty* StrProperty = Cast<UStrProperty>(Property))
 	{
-		StrProperty->SetPropertyValue(Data, IndexStringFromSchema(Object, FieldId, Index));
+		StrProperty->SetPropertyValue(Data, Field.Strings[Index]);
 	}
 	else if (UTextProperty* TextProperty = Cast<UTextProperty>(Property))
 	{
-		TextProperty->SetPropertyValue(Data, FText::FromString(IndexStringFromSchema(Object, FieldId, Index)));
+		TextProperty->SetPropertyValue(Data, FText::FromString(Field.Strings[Index]));
 	}
 	else if (UEnumProperty* EnumProperty = Cast<UEnumProperty>(Property))
 	{
 		if (EnumProperty->ElementSize < 4)
 		{
-			EnumProperty->GetUnderlyingProperty()->SetIntPropertyValue(Data, (uint64)Schema_IndexUint32(Object, FieldId, Index));
+			EnumProperty->GetUnderlyingProperty()->SetIntPropertyValue(Data, (uint64)(uint32)Field.Integers[Index]);
 		}
 		else
 		{
-			ApplyProperty(Object, FieldId, InObjectReferencesMap, Index, EnumProperty->GetUnderlyingProperty(), Data, Offset, ShadowOffset, ParentIndex);
+			ApplyProperty(Field, InObjectReferencesMap, Index, EnumProperty->GetUnderlyingProperty(), Data, Offset, ShadowOffset, ParentIndex);
 		}
 	}
 	else
 	{
-		checkf(false, TEXT("Tried to read unknown property in field %d"), FieldId);
+		checkf(false, TEXT("Tried to read unknown property in field %d"), Field.FieldId);
 	}
 }
 
-void ComponentReader::ApplyArray(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, UArrayProperty* Property, uint8* Data, int32 Offset, int32 ShadowOffset, int32 ParentIndex)
+void ComponentReader::ApplyArray(ParsedSchemaField& Field, FObjectReferencesMap& InObjectReferencesMap, UArrayProperty* Property, uint8* Data, int32 Offset, int32 ShadowOffset, int32 ParentIndex)
 {
 	FObjectReferencesMap* ArrayObjectReferences;
 	bool bNewArrayMap = false;
@@ -395,13 +424,13 @@ void ComponentReader::ApplyArray(Schema_Object* Object, Schema_FieldId FieldId,
 
 	FScriptArrayHelper ArrayHelper(Property, Data);
 
-	int Count = GetPropertyCount(Object, FieldId, Property->Inner);
+	int Count = Field.Num();
 	ArrayHelper.Resize(Count);
 
 	for (int i = 0; i < Count; i++)
 	{
 		int32 ElementOffset = i * Property->Inner->ElementSize;
-		ApplyProperty(Object, FieldId, *ArrayObjectReferences, i, Property->Inner, ArrayHelper.GetRawPtr(i), ElementOffset, ElementOffset, ParentIndex);
+		ApplyProperty(Field, *ArrayObjectReferences, i, Property->Inner, ArrayHelper.GetRawPtr(i), ElementOffset, ElementOffset, ParentIndex);
 	}
 
 	if (ArrayObjectReferences->Num() > 0)
@@ -425,92 +454,4 @@ void ComponentReader::ApplyArray(Schema_Object* Object, Schema_FieldId FieldId,
 	}
 }
 
-uint32 ComponentReader::GetPropertyCount(const Schema_Object* Object, Schema_FieldId FieldId, UProperty* Property)
-{
-	if (UStructProperty* StructProperty = Cast<UStructProperty>(Property))
-	{
-		return Schema_GetBytesCount(Object, FieldId);
-	}
-	else if (UBoolProperty* BoolProperty = Cast<UBoolProperty>(Property))
-	{
-		return Schema_GetBoolCount(Object, FieldId);
-	}
-	else if (UFloatProperty* FloatProperty = Cast<UFloatProperty>(Property))
-	{
-		return Schema_GetFloatCount(Object, FieldId);
-	}
-	else if (UDoubleProperty* DoubleProperty = Cast<UDoubleProperty>(Property))
-	{
-		return Schema_GetDoubleCount(Object, FieldId);
-	}
-	else if (UInt8Property* Int8Property = Cast<UInt8Property>(Property))
-	{
-		return Schema_GetInt32Count(Object, FieldId);
-	}
-	else if (UInt16Property* Int16Property = Cast<UInt16Property>(Property))
-	{
-		return Schema_GetInt32Count(Object, FieldId);
-	}
-	else if (UIntProperty* IntProperty = Cast<UIntProperty>(Property))
-	{
-		return Schema_GetInt32Count(Object, FieldId);
-	}
-	else if (UInt64Property* Int64Property = Cast<UInt64Property>(Property))
-	{
-		return Schema_GetInt64Count(Object, FieldId);
-	}
-	else if (UByteProperty* ByteProperty = Cast<UByteProperty>(Property))
-	{
-		return Schema_GetUint32Count(Object, FieldId);
-	}
-	else if (UUInt16Property* UInt16Property = Cast<UUInt16Property>(Property))
-	{
-		return Schema_GetUint32Count(Object, FieldId);
-	}
-	else if (UUInt32Property* UInt32Property = Cast<UUInt32Property>(Property))
-	{
-		return Schema_GetUint32Count(Object, FieldId);
-	}
-	else if (UUInt64Property* UInt64Property = Cast<UUInt64Property>(Property))
-	{
-		return Schema_GetUint64Count(Object, FieldId);
-	}
-	else if (UObjectPropertyBase* ObjectProperty = Cast<UObjectPropertyBase>(Property))
-	{
-		return Schema_GetObjectCount(Object, FieldId);
-	}
-	else if (UNameProperty* NameProperty = Cast<UNameProperty>(Property))
-	{
-		return Schema_GetBytesCount(Object, FieldId);
-	}
-	else if (UStrProperty* StrProperty = Cast<UStrProperty>(Property))
-	{
-		return Schema_GetBytesCount(Object, FieldId);
-	}
-	else if (UTextProperty* TextProperty = Cast<UTextProperty>(Property))
-	{
-		return Schema_GetBytesCount(Object, FieldId);
-	}
-	else if (UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property))
-	{
-		return GetPropertyCount(Object, FieldId, ArrayProperty->Inner);
-	}
-	else if (UEnumProperty* EnumProperty = Cast<UEnumProperty>(Property))
-	{
-		if (EnumProperty->ElementSize < 4)
-		{
-			return Schema_GetUint32Count(Object, FieldId);
-		}
-		else
-		{
-			return GetPropertyCount(Object, FieldId, EnumProperty->GetUnderlyingProperty());
-		}
-	}
-	else
-	{
-		checkf(false, TEXT("Tried to get count of unknown property in field %d"), FieldId);
-		return 0;
-	}
-}
-
 } // namespace SpatialGDK
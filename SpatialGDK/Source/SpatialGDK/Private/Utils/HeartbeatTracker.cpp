@@ -0,0 +1,52 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/HeartbeatTracker.h"
+
+void FHeartbeatTracker::Add(Worker_EntityId EntityId, double Time)
+{
+	Remove(EntityId);
+
+	FSweepOrder::TDoubleLinkedListNode* Node = new FSweepOrder::TDoubleLinkedListNode(FEntry{ EntityId, Time });
+	SweepOrder.AddTail(Node);
+	Nodes.Add(EntityId, Node);
+}
+
+void FHeartbeatTracker::Remove(Worker_EntityId EntityId)
+{
+	FSweepOrder::TDoubleLinkedListNode* Node = nullptr;
+	if (Nodes.RemoveAndCopyValue(EntityId, Node))
+	{
+		SweepOrder.RemoveNode(Node);
+	}
+}
+
+void FHeartbeatTracker::OnHeartbeat(Worker_EntityId EntityId, double Time)
+{
+	if (FSweepOrder::TDoubleLinkedListNode** NodePtr = Nodes.Find(EntityId))
+	{
+		FSweepOrder::TDoubleLinkedListNode* Node = *NodePtr;
+		Node->GetValue().LastHeartbeatTime = Time;
+
+		if (Node != SweepOrder.GetTail())
+		{
+			SweepOrder.RemoveNode(Node, /* bDeleteNode */ false);
+			SweepOrder.AddTail(Node);
+		}
+	}
+}
+
+void FHeartbeatTracker::RemoveTimedOut(double Deadline, TArray<Worker_EntityId>& OutTimedOut)
+{
+	while (FSweepOrder::TDoubleLinkedListNode* Node = SweepOrder.GetHead())
+	{
+		const FEntry& Entry = Node->GetValue();
+		if (Entry.LastHeartbeatTime >= Deadline)
+		{
+			break;
+		}
+
+		OutTimedOut.Add(Entry.EntityId);
+		Nodes.Remove(Entry.EntityId);
+		SweepOrder.RemoveNode(Node);
+	}
+}
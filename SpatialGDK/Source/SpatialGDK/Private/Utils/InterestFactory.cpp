@@ -14,12 +14,64 @@
 #include "SpatialGDKSettings.h"
 #include "SpatialConstants.h"
 #include "UObject/UObjectIterator.h"
+#include "Utils/SpatialMetrics.h"
 
 DEFINE_LOG_CATEGORY(LogInterestFactory);
 
 namespace
 {
 static TMap<UClass*, float> ClientInterestDistancesSquared;
+
+// Constraints which don't depend on the actor instance are built once and shared by every InterestFactory.
+// They are invalidated whenever the client interest distances are gathered again, and the checkout radius
+// constraint also whenever a new Actor class is registered.
+static TOptional<SpatialGDK::QueryConstraint> CachedCheckoutRadiusConstraint;
+static TOptional<SpatialGDK::QueryConstraint> CachedAlwaysRelevantConstraint;
+
+// Server interest for actors which declare no custom interest (no AlwaysInterested properties and no UActorInterestComponent)
+// is identical for every such actor, so it is only built once.
+static TOptional<SpatialGDK::Interest> CachedDefaultActorInterest;
+
+// Result components and queries used by clients when property groups are in use. Like the constraints above,
+// they only depend on the schema database and settings.
+static TOptional<TArray<uint32>> CachedClientResultComponentIds;
+static TOptional<TArray<SpatialGDK::Query>> CachedPropertyGroupQueries;
+
+// Returns true if clients need a larger interest distance than the default for Actors of this class.
+bool GetClientInterestDistanceSquared(UClass* Class, float DefaultDistanceSquared, float MaxDistanceSquared, float& OutDistanceSquared)
+{
+	if (Class->HasAnySpatialClassFlags(SPATIALCLASS_ServerOnly | SPATIALCLASS_NotSpatialType))
+	{
+		return false;
+	}
+	if (Class->HasAnyClassFlags(CLASS_NewerVersionExists))
+	{
+		// This skips classes generated for hot reload etc (i.e. REINST_, SKEL_, TRASHCLASS_)
+		return false;
+	}
+	if (!Class->IsChildOf<AActor>())
+	{
+		return false;
+	}
+
+	const AActor* ClassDefaultActor = Cast<AActor>(Class->GetDefaultObject());
+	if (ClassDefaultActor->NetCullDistanceSquared <= DefaultDistanceSquared)
+	{
+		return false;
+	}
+
+	OutDistanceSquared = ClassDefaultActor->NetCullDistanceSquared;
+
+	if (MaxDistanceSquared != 0.f && OutDistanceSquared > MaxDistanceSquared)
+	{
+		UE_LOG(LogInterestFactory, Warning, TEXT("NetCullDistanceSquared for %s too large, clamping from %f to %f"),
+			*Class->GetName(), OutDistanceSquared, MaxDistanceSquared);
+
+		OutDistanceSquared = MaxDistanceSquared;
+	}
+
+	return true;
+}
 }
 
 namespace SpatialGDK
@@ -27,6 +79,11 @@ namespace SpatialGDK
 void GatherClientInterestDistances()
 {
 	ClientInterestDistancesSquared.Empty();
+	CachedCheckoutRadiusConstraint.Reset();
+	CachedAlwaysRelevantConstraint.Reset();
+	CachedDefaultActorInterest.Reset();
+	CachedClientResultComponentIds.Reset();
+	CachedPropertyGroupQueries.Reset();
 
 	const AActor* DefaultActor = Cast<AActor>(AActor::StaticClass()->GetDefaultObject());
 	const float DefaultDistanceSquared = DefaultActor->NetCullDistanceSquared;
@@ -36,33 +93,9 @@ void GatherClientInterestDistances()
 	TMap<UClass*, float> DiscoveredInterestDistancesSquared;
 	for (TObjectIterator<UClass> It; It; ++It)
 	{
-		if (It->HasAnySpatialClassFlags(SPATIALCLASS_ServerOnly | SPATIALCLASS_NotSpatialType))
-		{
-			continue;
-		}
-		if (It->HasAnyClassFlags(CLASS_NewerVersionExists))
+		float ActorNetCullDistanceSquared;
+		if (GetClientInterestDistanceSquared(*It, DefaultDistanceSquared, MaxDistanceSquared, ActorNetCullDistanceSquared))
 		{
-			// This skips classes generated for hot reload etc (i.e. REINST_, SKEL_, TRASHCLASS_)
-			continue;
-		}
-		if (!It->IsChildOf<AActor>())
-		{
-			continue;
-		}
-
-		const AActor* IteratedDefaultActor = Cast<AActor>(It->GetDefaultObject());
-		if (IteratedDefaultActor->NetCullDistanceSquared > DefaultDistanceSquared)
-		{
-			float ActorNetCullDistanceSquared = IteratedDefaultActor->NetCullDistanceSquared;
-
-			if (MaxDistanceSquared != 0.f && IteratedDefaultActor->NetCullDistanceSquared > MaxDistanceSquared)
-			{
-				UE_LOG(LogInterestFactory, Warning, TEXT("NetCullDistanceSquared for %s too large, clamping from %f to %f"),
-					*It->GetName(), ActorNetCullDistanceSquared, MaxDistanceSquared);
-
-				ActorNetCullDistanceSquared = MaxDistanceSquared;
-			}
-
 			DiscoveredInterestDistancesSquared.Add(*It, ActorNetCullDistanceSquared);
 		}
 	}
@@ -97,24 +130,97 @@ void GatherClientInterestDistances()
 	}
 }
 
+void OnActorClassRegistered(UClass* Class)
+{
+	// The checkout radius constraints list the component ids of every loaded class in a hierarchy, so they are rebuilt
+	// on next use to include this class. Constraints that don't depend on classes are kept.
+	CachedCheckoutRadiusConstraint.Reset();
+	CachedDefaultActorInterest.Reset();
+
+	const AActor* DefaultActor = Cast<AActor>(AActor::StaticClass()->GetDefaultObject());
+	float ActorNetCullDistanceSquared;
+	if (!GetClientInterestDistanceSquared(Class, DefaultActor->NetCullDistanceSquared, GetDefault<USpatialGDKSettings>()->MaxNetCullDistanceSquared, ActorNetCullDistanceSquared))
+	{
+		return;
+	}
+
+	for (const auto& InterestDistanceSquared : ClientInterestDistancesSquared)
+	{
+		if (Class->IsChildOf(InterestDistanceSquared.Key) && ActorNetCullDistanceSquared <= InterestDistanceSquared.Value)
+		{
+			// Already captured by a parent class.
+			return;
+		}
+	}
+
+	ClientInterestDistancesSquared.Add(Class, ActorNetCullDistanceSquared);
+}
+
 InterestFactory::InterestFactory(AActor* InActor, const FClassInfo& InInfo, USpatialNetDriver* InNetDriver)
 	: Actor(InActor)
 	, Info(InInfo)
 	, NetDriver(InNetDriver)
 	, PackageMap(InNetDriver->PackageMap)
+	, ActorInterestComponent(nullptr)
 {
+	TArray<UActorInterestComponent*> ActorInterestComponents;
+	Actor->GetComponents<UActorInterestComponent>(ActorInterestComponents);
+	if (ActorInterestComponents.Num() == 1)
+	{
+		ActorInterestComponent = ActorInterestComponents[0];
+	}
+	else if (ActorInterestComponents.Num() > 1)
+	{
+		UE_LOG(LogInterestFactory, Error, TEXT("%s has more than one ActorInterestQueryComponent"), *Actor->GetPathName());
+	}
 }
 
 Worker_ComponentData InterestFactory::CreateInterestData() const
 {
+	FSpatialLoadScope LoadScope(NetDriver->SpatialMetrics, ESpatialLoadSubsystem::Interest);
+
+	if (Interest* SharedInterest = GetSharedActorInterest())
+	{
+		return SharedInterest->CreateInterestData();
+	}
+
 	return CreateInterest().CreateInterestData();
 }
 
 Worker_ComponentUpdate InterestFactory::CreateInterestUpdate() const
 {
+	FSpatialLoadScope LoadScope(NetDriver->SpatialMetrics, ESpatialLoadSubsystem::Interest);
+
+	if (Interest* SharedInterest = GetSharedActorInterest())
+	{
+		return SharedInterest->CreateInterestUpdate();
+	}
+
 	return CreateInterest().CreateInterestUpdate();
 }
 
+Interest* InterestFactory::GetSharedActorInterest() const
+{
+	// Fast path: with server QBI, actors that aren't player owned and declare no custom interest all share the same interest.
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	if (!SpatialGDKSettings->bUsingQBI || !SpatialGDKSettings->bEnableServerQBI)
+	{
+		return nullptr;
+	}
+
+	if (HasCustomInterest() || Actor->GetNetConnection() != nullptr)
+	{
+		return nullptr;
+	}
+
+	if (!CachedDefaultActorInterest.IsSet())
+	{
+		CachedDefaultActorInterest = CreateActorInterest();
+	}
+
+	return &CachedDefaultActorInterest.GetValue();
+}
+
 Interest InterestFactory::CreateInterest() const
 {
 	if (!GetDefault<USpatialGDKSettings>()->bUsingQBI)
@@ -201,10 +307,30 @@ Interest InterestFactory::CreatePlayerOwnedActorInterest() const
 
 	Query ClientQuery;
 	ClientQuery.Constraint = ClientConstraint;
-	ClientQuery.FullSnapshotResult = true;
 
 	ComponentInterest ClientComponentInterest;
-	ClientComponentInterest.Queries.Add(ClientQuery);
+
+	check(NetDriver != nullptr && NetDriver->ClassInfoManager);
+	// Query results can't exclude components, so property groups are opt-in: their interest lists every component clients may need.
+	if (GetDefault<USpatialGDKSettings>()->bEnableClientPropertyGroupInterest
+		&& NetDriver->ClassInfoManager->GetPropertyGroupComponentIds().Num() > 0 && !CachedClientResultComponentIds.IsSet())
+	{
+		CachedClientResultComponentIds = CreateClientResultComponentIds();
+	}
+
+	if (CachedClientResultComponentIds.IsSet() && CachedClientResultComponentIds->Num() > 0)
+	{
+		// Property group components are left out of the main query and checked out by their own, smaller, radius.
+		ClientQuery.ResultComponentId = CachedClientResultComponentIds.GetValue();
+		ClientComponentInterest.Queries.Add(ClientQuery);
+
+		AddPropertyGroupQueries(LevelConstraints, ClientComponentInterest.Queries);
+	}
+	else
+	{
+		ClientQuery.FullSnapshotResult = true;
+		ClientComponentInterest.Queries.Add(ClientQuery);
+	}
 
 	AddUserDefinedQueries(LevelConstraints, ClientComponentInterest.Queries);
 
@@ -228,39 +354,124 @@ void InterestFactory::AddUserDefinedQueries(const QueryConstraint& LevelConstrai
 	check(Actor);
 	check(NetDriver != nullptr && NetDriver->ClassInfoManager);
 
-	TArray<UActorInterestComponent*> ActorInterestComponents;
-	Actor->GetComponents<UActorInterestComponent>(ActorInterestComponents);
-	if (ActorInterestComponents.Num() == 1)
+	if (ActorInterestComponent != nullptr)
 	{
-		ActorInterestComponents[0]->CreateQueries(*NetDriver->ClassInfoManager, LevelConstraints, OutQueries);
+		ActorInterestComponent->CreateQueries(*NetDriver->ClassInfoManager, LevelConstraints, OutQueries);
 	}
-	else if (ActorInterestComponents.Num() > 1)
+}
+
+TArray<uint32> InterestFactory::CreateClientResultComponentIds() const
+{
+	// Every GDK and external schema component a client may need, the user schema components listed in the settings,
+	// followed by all generated components outside of property groups.
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	const TArray<Worker_ComponentId> GeneratedComponentIds = NetDriver->ClassInfoManager->GetComponentIdsOutsidePropertyGroups();
+	const int32 NumExternalSchemaComponentIds = SpatialConstants::MAX_EXTERNAL_SCHEMA_ID - SpatialConstants::MIN_EXTERNAL_SCHEMA_ID + 1;
+	const int32 NumComponentIds = SpatialConstants::ClientVisibleGDKComponentIds.Num() + NumExternalSchemaComponentIds
+		+ SpatialGDKSettings->AdditionalClientResultComponentIds.Num() + GeneratedComponentIds.Num();
+
+	// The list is sent in the Interest component of every player owned entity, so it is bounded. An empty result makes clients
+	// check out full entities instead.
+	if ((uint32)NumComponentIds > SpatialGDKSettings->MaxClientResultComponentIds)
 	{
-		UE_LOG(LogInterestFactory, Error, TEXT("%s has more than one ActorInterestQueryComponent"), *Actor->GetPathName());
+		UE_LOG(LogInterestFactory, Warning, TEXT("%d client result components exceed MaxClientResultComponentIds (%u). Property groups will use the Actor's NetCullDistanceSquared."),
+			NumComponentIds, SpatialGDKSettings->MaxClientResultComponentIds);
+		return TArray<uint32>();
 	}
+
+	TArray<uint32> ResultComponentIds;
+	ResultComponentIds.Reserve(NumComponentIds);
+	ResultComponentIds.Append(SpatialConstants::ClientVisibleGDKComponentIds);
+	for (Worker_ComponentId ComponentId = SpatialConstants::MIN_EXTERNAL_SCHEMA_ID; ComponentId <= SpatialConstants::MAX_EXTERNAL_SCHEMA_ID; ComponentId++)
+	{
+		ResultComponentIds.Add(ComponentId);
+	}
+	ResultComponentIds.Append(SpatialGDKSettings->AdditionalClientResultComponentIds);
+	ResultComponentIds.Append(GeneratedComponentIds);
+
+	UE_LOG(LogInterestFactory, Log, TEXT("Client interest lists %d result components to leave out property groups."), ResultComponentIds.Num());
+
+	return ResultComponentIds;
 }
 
-QueryConstraint InterestFactory::CreateSystemDefinedConstraints() const
+void InterestFactory::AddPropertyGroupQueries(const QueryConstraint& LevelConstraints, TArray<SpatialGDK::Query>& OutQueries) const
 {
-	QueryConstraint CheckoutRadiusConstraint = CreateCheckoutRadiusConstraints();
-	QueryConstraint AlwaysInterestedConstraint = CreateAlwaysInterestedConstraint();
-	QueryConstraint AlwaysRelevantConstraint = CreateAlwaysRelevantConstraint();
+	if (!CachedPropertyGroupQueries.IsSet())
+	{
+		const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+
+		TArray<Query> PropertyGroupQueries;
+		for (const auto& PropertyGroup : NetDriver->ClassInfoManager->GetPropertyGroupComponentIds())
+		{
+			const float* DistanceSquared = SpatialGDKSettings->PropertyGroupNetCullDistanceSquared.Find(PropertyGroup.Key);
+			const float RadiusMeters = FMath::Sqrt((DistanceSquared != nullptr ? *DistanceSquared : SpatialGDKSettings->DefaultPropertyGroupNetCullDistanceSquared) / (100.0f * 100.0f));
 
+			Query PropertyGroupQuery;
+			PropertyGroupQuery.Constraint.RelativeCylinderConstraint = RelativeCylinderConstraint{ RadiusMeters };
+			PropertyGroupQuery.ResultComponentId = PropertyGroup.Value;
+			PropertyGroupQueries.Add(PropertyGroupQuery);
+		}
+
+		CachedPropertyGroupQueries = MoveTemp(PropertyGroupQueries);
+	}
+
+	// The level constraints depend on the client's loaded levels, so they're added per actor.
+	for (const Query& CachedQuery : CachedPropertyGroupQueries.GetValue())
+	{
+		Query PropertyGroupQuery;
+		PropertyGroupQuery.ResultComponentId = CachedQuery.ResultComponentId;
+		PropertyGroupQuery.Constraint.AndConstraint.Add(CachedQuery.Constraint);
+		if (LevelConstraints.IsValid())
+		{
+			PropertyGroupQuery.Constraint.AndConstraint.Add(LevelConstraints);
+		}
+		OutQueries.Add(MoveTemp(PropertyGroupQuery));
+	}
+}
+
+bool InterestFactory::HasCustomInterest() const
+{
+	return Info.InterestProperties.Num() > 0 || ActorInterestComponent != nullptr;
+}
+
+QueryConstraint InterestFactory::CreateSystemDefinedConstraints() const
+{
 	QueryConstraint SystemDefinedConstraints;
 
-	if (CheckoutRadiusConstraint.IsValid())
+	// If the actor has a component to specify interest and that indicates that we shouldn't generate
+	// constraints based on NetCullDistanceSquared, skip the checkout radius. There is a check in the
+	// constructor to ensure that there is at most one ActorInterestQueryComponent.
+	if (ActorInterestComponent == nullptr || ActorInterestComponent->bUseNetCullDistanceSquaredForCheckoutRadius)
+	{
+		if (!CachedCheckoutRadiusConstraint.IsSet())
+		{
+			CachedCheckoutRadiusConstraint = CreateCheckoutRadiusConstraints();
+		}
+
+		if (CachedCheckoutRadiusConstraint->IsValid())
+		{
+			SystemDefinedConstraints.OrConstraint.Add(CachedCheckoutRadiusConstraint.GetValue());
+		}
+	}
+
+	// Only the AlwaysInterested entity ids are specific to this actor instance.
+	if (Info.InterestProperties.Num() > 0)
 	{
-		SystemDefinedConstraints.OrConstraint.Add(CheckoutRadiusConstraint);
+		QueryConstraint AlwaysInterestedConstraint = CreateAlwaysInterestedConstraint();
+		if (AlwaysInterestedConstraint.IsValid())
+		{
+			SystemDefinedConstraints.OrConstraint.Add(MoveTemp(AlwaysInterestedConstraint));
+		}
 	}
 
-	if (AlwaysInterestedConstraint.IsValid())
+	if (!CachedAlwaysRelevantConstraint.IsSet())
 	{
-		SystemDefinedConstraints.OrConstraint.Add(AlwaysInterestedConstraint);
+		CachedAlwaysRelevantConstraint = CreateAlwaysRelevantConstraint();
 	}
 
-	if (AlwaysRelevantConstraint.IsValid())
+	if (CachedAlwaysRelevantConstraint->IsValid())
 	{
-		SystemDefinedConstraints.OrConstraint.Add(AlwaysRelevantConstraint);
+		SystemDefinedConstraints.OrConstraint.Add(CachedAlwaysRelevantConstraint.GetValue());
 	}
 
 	return SystemDefinedConstraints;
@@ -268,20 +479,6 @@ QueryConstraint InterestFactory::CreateSystemDefinedConstraints() const
 
 QueryConstraint InterestFactory::CreateCheckoutRadiusConstraints() const
 {
-	// If the actor has a component to specify interest and that indicates that we shouldn't generate
-	// constraints based on NetCullDistanceSquared, abort. There is a check elsewhere to ensure that
-	// there is at most one ActorInterestQueryComponent.
-	TArray<UActorInterestComponent*> ActorInterestComponents;
-	Actor->GetComponents<UActorInterestComponent>(ActorInterestComponents);
-	if (ActorInterestComponents.Num() == 1)
-	{
-		const UActorInterestComponent* ActorInterest = ActorInterestComponents[0];
-		check(ActorInterest);
-		if (!ActorInterest->bUseNetCullDistanceSquaredForCheckoutRadius)
-		{
-			return QueryConstraint{};
-		}
-	}
 
 	// Checkout Radius constraints are defined by the NetCullDistanceSquared property on actors.
 	//   - Checkout radius is a RelativeCylinder constraint on the player controller.
@@ -0,0 +1,163 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/RPCParameterCodec.h"
+
+#include "Net/DataBunch.h"
+#include "UObject/UnrealType.h"
+
+#include "Utils/RepLayoutUtils.h"
+
+namespace
+{
+
+// Inline space for the byte block, enough for the parameters of most RPCs.
+using FBlockBuffer = TArray<uint8, TInlineAllocator<256>>;
+
+// Only types whose NetSerializeItem doesn't validate the received value are copied raw. Bools are normalized on read, and bytes are left
+// to NetSerializeItem, which clamps enum values to the enum's range.
+bool IsBlockCmd(ERepLayoutCmdType Type)
+{
+	switch (Type)
+	{
+	case ERepLayoutCmdType::PropertyBool:
+	case ERepLayoutCmdType::PropertyNativeBool:
+	case ERepLayoutCmdType::PropertyFloat:
+	case ERepLayoutCmdType::PropertyInt:
+	case ERepLayoutCmdType::PropertyUInt32:
+	case ERepLayoutCmdType::PropertyUInt64:
+	case ERepLayoutCmdType::PropertyVector:
+	case ERepLayoutCmdType::PropertyRotator:
+		return true;
+	default:
+		return false;
+	}
+}
+
+} // anonymous namespace
+
+FRPCParameterCodec::FRPCParameterCodec(const TSharedPtr<FRepLayout>& InRepLayout)
+	: RepLayout(InRepLayout)
+{
+	for (const FRepParentCmd& Parent : RepLayout->Parents)
+	{
+		if (Parent.ArrayIndex == 0 && (Parent.Property->PropertyFlags & CPF_ZeroConstructor) == 0)
+		{
+			PropertiesToInitialize.Add(Parent.Property);
+		}
+
+		for (int32 CmdIndex = Parent.CmdStart; CmdIndex < Parent.CmdEnd; CmdIndex++)
+		{
+			const FRepLayoutCmd& Cmd = RepLayout->Cmds[CmdIndex];
+
+			check(Cmd.Type != ERepLayoutCmdType::Return);
+
+			if (IsBlockCmd(Cmd.Type))
+			{
+				FBlockOp Op;
+				Op.Offset = Cmd.Offset;
+				const bool bIsBool = Cmd.Type == ERepLayoutCmdType::PropertyBool || Cmd.Type == ERepLayoutCmdType::PropertyNativeBool;
+				Op.BoolProperty = bIsBool ? Cast<UBoolProperty>(Cmd.Property) : nullptr;
+				Op.Size = Op.BoolProperty != nullptr ? 1 : Cmd.Property->ElementSize;
+
+				BlockOps.Add(Op);
+				BlockSize += Op.Size;
+				continue;
+			}
+
+			// Dynamic arrays are serialized as a whole, including their element commands.
+			const int32 CmdEnd = Cmd.Type == ERepLayoutCmdType::DynamicArray ? Cmd.EndCmd : CmdIndex + 1;
+
+			// Merge with the previous generic operation if the commands are consecutive.
+			if (GenericOps.Num() > 0 && GenericOps.Last().CmdEnd == CmdIndex)
+			{
+				GenericOps.Last().CmdEnd = CmdEnd;
+			}
+			else
+			{
+				GenericOps.Add(FGenericOp{ CmdIndex, CmdEnd });
+			}
+
+			CmdIndex = CmdEnd - 1;
+		}
+	}
+}
+
+void FRPCParameterCodec::Write(FNetBitWriter& Writer, void* Parameters) const
+{
+	uint8* Data = static_cast<uint8*>(Parameters);
+
+	if (BlockSize > 0)
+	{
+		FBlockBuffer Block;
+		Block.AddUninitialized(BlockSize);
+
+		uint8* BlockData = Block.GetData();
+		for (const FBlockOp& Op : BlockOps)
+		{
+			if (Op.BoolProperty != nullptr)
+			{
+				*BlockData = Op.BoolProperty->GetPropertyValue(Data + Op.Offset) ? 1 : 0;
+			}
+			else
+			{
+				FMemory::Memcpy(BlockData, Data + Op.Offset, Op.Size);
+			}
+			BlockData += Op.Size;
+		}
+
+		Writer.Serialize(Block.GetData(), BlockSize);
+	}
+
+	for (const FGenericOp& Op : GenericOps)
+	{
+		bool bHasUnmapped = false;
+		SpatialGDK::RepLayout_SerializeProperties(*RepLayout, Writer, Writer.PackageMap, Op.CmdStart, Op.CmdEnd, Parameters, bHasUnmapped);
+	}
+}
+
+void FRPCParameterCodec::Read(FNetBitReader& Reader, void* Parameters) const
+{
+	uint8* Data = static_cast<uint8*>(Parameters);
+
+	for (UProperty* Property : PropertiesToInitialize)
+	{
+		Property->InitializeValue(Data + Property->GetOffset_ForUFunction());
+	}
+
+	if (BlockSize > 0)
+	{
+		FBlockBuffer Block;
+		Block.AddUninitialized(BlockSize);
+
+		Reader.Serialize(Block.GetData(), BlockSize);
+		if (Reader.IsError())
+		{
+			return;
+		}
+
+		const uint8* BlockData = Block.GetData();
+		for (const FBlockOp& Op : BlockOps)
+		{
+			if (Op.BoolProperty != nullptr)
+			{
+				Op.BoolProperty->SetPropertyValue(Data + Op.Offset, *BlockData != 0);
+			}
+			else
+			{
+				FMemory::Memcpy(Data + Op.Offset, BlockData, Op.Size);
+			}
+			BlockData += Op.Size;
+		}
+	}
+
+	for (const FGenericOp& Op : GenericOps)
+	{
+		bool bHasUnmapped = false;
+		SpatialGDK::RepLayout_SerializeProperties(*RepLayout, Reader, Reader.PackageMap, Op.CmdStart, Op.CmdEnd, Parameters, bHasUnmapped);
+
+		if (Reader.IsError())
+		{
+			return;
+		}
+	}
+}
@@ -5,6 +5,7 @@
 #include "Engine/Engine.h"
 #include "EngineGlobals.h"
 #include "GameFramework/PlayerController.h"
+#include "Misc/App.h"
 
 #include "EngineClasses/SpatialNetConnection.h"
 #include "EngineClasses/SpatialNetDriver.h"
@@ -24,12 +25,28 @@ void USpatialMetrics::Init(USpatialNetDriver* InNetDriver)
 
 	bRPCTrackingEnabled = false;
 	RPCTrackingStartTime = 0.0f;
+
+	AverageFPS = 0.0;
+	WorkerLoad = 0.0;
+	FrameTimeSinceLastReport = 0.0;
+	BusyTimeSinceLastReport = 0.0;
+
+	bTrackSubsystemLoad = GetDefault<USpatialGDKSettings>()->bReportSubsystemLoad;
+	ActiveSubsystem = ESpatialLoadSubsystem::Count;
+	ActiveSubsystemStartTime = 0.0;
+	FMemory::Memzero(SubsystemTimeSinceLastReport);
 }
 
 void USpatialMetrics::TickMetrics()
 {
 	FramesSinceLastReport++;
 
+	// The engine sleeps at the end of the frame when the tick rate is capped. That wait is part of the
+	// frame time but not of the time the game thread was busy.
+	const double FrameTime = FApp::GetDeltaTime();
+	FrameTimeSinceLastReport += FrameTime;
+	BusyTimeSinceLastReport += FMath::Clamp(FrameTime - FApp::GetIdleTime(), 0.0, FrameTime);
+
 	TimeSinceLastReport = NetDriver->Time - TimeOfLastReport;
 
 	// Check that there has been a sufficient amount of time since the last report.
@@ -38,9 +55,26 @@ void USpatialMetrics::TickMetrics()
 		return;
 	}
 
+	const int32 MaxLoadSamples = FMath::Max(GetDefault<USpatialGDKSettings>()->LoadSmoothingReportCount, 1);
+	if (LoadSamples.Num() >= MaxLoadSamples)
+	{
+		LoadSamples.RemoveAt(0, LoadSamples.Num() - MaxLoadSamples + 1, false);
+	}
+	LoadSamples.Add(FLoadSample{ FramesSinceLastReport, BusyTimeSinceLastReport });
+
 	AverageFPS = FramesSinceLastReport / TimeSinceLastReport;
 	WorkerLoad = CalculateLoad();
 
+	SendMetrics();
+
+	TimeOfLastReport = NetDriver->Time;
+	FramesSinceLastReport = 0;
+	FrameTimeSinceLastReport = 0.0;
+	BusyTimeSinceLastReport = 0.0;
+}
+
+void USpatialMetrics::SendMetrics()
+{
 	SpatialGDK::GaugeMetric DynamicFPSGauge;
 	DynamicFPSGauge.Key = TCHAR_TO_UTF8(*SpatialConstants::SPATIALOS_METRICS_DYNAMIC_FPS);
 	DynamicFPSGauge.Value = AverageFPS;
@@ -49,13 +83,56 @@ void USpatialMetrics::TickMetrics()
 	DynamicFPSMetrics.GaugeMetrics.Add(DynamicFPSGauge);
 	DynamicFPSMetrics.Load = WorkerLoad;
 
-	TimeOfLastReport = NetDriver->Time;
-	FramesSinceLastReport = 0;
+	if (bTrackSubsystemLoad)
+	{
+		// Time spent in the subsystem that is active while reporting belongs to this report.
+		AttributeSubsystemTime();
+
+		const FString* SubsystemKeys[] = {
+			&SpatialConstants::SPATIALOS_METRICS_OP_PROCESSING_LOAD,
+			&SpatialConstants::SPATIALOS_METRICS_REPLICATION_LOAD,
+			&SpatialConstants::SPATIALOS_METRICS_RPC_LOAD,
+			&SpatialConstants::SPATIALOS_METRICS_INTEREST_LOAD
+		};
+		static_assert(ARRAY_COUNT(SubsystemKeys) == static_cast<int32>(ESpatialLoadSubsystem::Count), "Every subsystem needs a metrics key");
+
+		for (int32 i = 0; i < ARRAY_COUNT(SubsystemKeys); i++)
+		{
+			SpatialGDK::GaugeMetric SubsystemGauge;
+			SubsystemGauge.Key = TCHAR_TO_UTF8(**SubsystemKeys[i]);
+			SubsystemGauge.Value = FrameTimeSinceLastReport > 0.0 ? SubsystemTimeSinceLastReport[i] / FrameTimeSinceLastReport : 0.0;
+			DynamicFPSMetrics.GaugeMetrics.Add(SubsystemGauge);
+		}
+
+		FMemory::Memzero(SubsystemTimeSinceLastReport);
+	}
+
+	// How far the game thread is behind on the ops received from SpatialOS.
+	const FOpListQueueStats OpListQueueStats = NetDriver->Connection->TakeOpListQueueStats();
+	auto AddOpListQueueGauge = [&DynamicFPSMetrics](const FString& Key, double Value)
+	{
+		SpatialGDK::GaugeMetric OpListQueueGauge;
+		OpListQueueGauge.Key = TCHAR_TO_UTF8(*Key);
+		OpListQueueGauge.Value = Value;
+		DynamicFPSMetrics.GaugeMetrics.Add(OpListQueueGauge);
+	};
+
+	AddOpListQueueGauge(SpatialConstants::SPATIALOS_METRICS_OP_LIST_QUEUE_DEPTH, OpListQueueStats.MaxDepth);
+	AddOpListQueueGauge(SpatialConstants::SPATIALOS_METRICS_OP_LIST_MAX_DWELL_TIME, OpListQueueStats.MaxDwellTime);
+	AddOpListQueueGauge(SpatialConstants::SPATIALOS_METRICS_OP_LIST_AVERAGE_DWELL_TIME, OpListQueueStats.NumOpLists > 0 ? OpListQueueStats.TotalDwellTime / OpListQueueStats.NumOpLists : 0.0);
+	AddOpListQueueGauge(SpatialConstants::SPATIALOS_METRICS_OP_LIST_QUEUE_FULL_COUNT, OpListQueueStats.NumTimesFull);
+
+	if (OpListQueueStats.NumTimesFull > 0)
+	{
+		UE_LOG(LogSpatialMetrics, Warning, TEXT("The queue of op lists received from SpatialOS was full %d times since the last report, ops waited up to %.3fs to be processed."),
+			OpListQueueStats.NumTimesFull, OpListQueueStats.MaxDwellTime);
+	}
 
 	NetDriver->Connection->SendMetrics(DynamicFPSMetrics);
 }
 
-// Load defined as performance relative to target frame time or just frame time based on config value.
+// Load defined as the game thread's busy time or frame time relative to the target frame time, or just frame time
+// based on config values.
 double USpatialMetrics::CalculateLoad() const
 {
 	float AverageFrameTime = TimeSinceLastReport / FramesSinceLastReport;
@@ -67,9 +144,50 @@ double USpatialMetrics::CalculateLoad() const
 
 	float TargetFrameTime = 1.0f / NetDriver->NetServerMaxTickRate;
 
+	if (GetDefault<USpatialGDKSettings>()->bUseBusyTimeAsLoad)
+	{
+		// Relative to the target frame time rather than the actual one, so a worker that can't keep up with its tick rate reports
+		// more than 1, and uncapped workers that never idle still report how much of the budget they use.
+		int32 NumFrames = 0;
+		double BusyTime = 0.0;
+		for (const FLoadSample& Sample : LoadSamples)
+		{
+			NumFrames += Sample.NumFrames;
+			BusyTime += Sample.BusyTime;
+		}
+
+		return NumFrames > 0 ? (BusyTime / NumFrames) / TargetFrameTime : 0.0;
+	}
+
 	return AverageFrameTime / TargetFrameTime;
 }
 
+ESpatialLoadSubsystem USpatialMetrics::EnterSubsystem(ESpatialLoadSubsystem Subsystem)
+{
+	AttributeSubsystemTime();
+
+	ESpatialLoadSubsystem PreviousSubsystem = ActiveSubsystem;
+	ActiveSubsystem = Subsystem;
+	return PreviousSubsystem;
+}
+
+void USpatialMetrics::ExitSubsystem(ESpatialLoadSubsystem PreviousSubsystem)
+{
+	AttributeSubsystemTime();
+
+	ActiveSubsystem = PreviousSubsystem;
+}
+
+void USpatialMetrics::AttributeSubsystemTime()
+{
+	const double Now = FPlatformTime::Seconds();
+	if (ActiveSubsystem != ESpatialLoadSubsystem::Count)
+	{
+		SubsystemTimeSinceLastReport[static_cast<int32>(ActiveSubsystem)] += Now - ActiveSubsystemStartTime;
+	}
+	ActiveSubsystemStartTime = Now;
+}
+
 void USpatialMetrics::SpatialStartRPCMetrics()
 {
 	if (bRPCTrackingEnabled)
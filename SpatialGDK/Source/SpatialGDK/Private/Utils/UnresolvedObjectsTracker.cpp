@@ -0,0 +1,81 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/UnresolvedObjectsTracker.h"
+
+void FUnresolvedObjectsTracker::QueueUpdate(const FChannelObjectPair& ChannelObjectPair, uint16 Handle, const FUnresolvedObjectsSet& UnresolvedObjects)
+{
+	ResetUpdate(ChannelObjectPair, Handle);
+
+	const int32 EntryIndex = AllocateEntry();
+	FEntry& Entry = Entries[EntryIndex];
+	Entry.Key = FEntryKey{ ChannelObjectPair, Handle };
+
+	for (const TWeakObjectPtr<const UObject>& UnresolvedObject : UnresolvedObjects)
+	{
+		Entry.UnresolvedObjects.Add(UnresolvedObject);
+		ObjectToEntryIndices.Add(UnresolvedObject, EntryIndex);
+	}
+
+	KeyToEntryIndex.Add(Entry.Key, EntryIndex);
+}
+
+void FUnresolvedObjectsTracker::ResetUpdate(const FChannelObjectPair& ChannelObjectPair, uint16 Handle)
+{
+	int32 EntryIndex = INDEX_NONE;
+	if (!KeyToEntryIndex.RemoveAndCopyValue(FEntryKey{ ChannelObjectPair, Handle }, EntryIndex))
+	{
+		return;
+	}
+
+	// Since these are not dereferenced before removing, it is safe to not check whether the unresolved object is still valid.
+	for (const TWeakObjectPtr<const UObject>& UnresolvedObject : Entries[EntryIndex].UnresolvedObjects)
+	{
+		ObjectToEntryIndices.RemoveSingle(UnresolvedObject, EntryIndex);
+	}
+
+	ReleaseEntry(EntryIndex);
+}
+
+void FUnresolvedObjectsTracker::ResolveObject(const UObject* Object, TMap<FChannelObjectPair, TArray<uint16>>& OutResolvedHandles)
+{
+	const TWeakObjectPtr<const UObject> WeakObject(Object);
+
+	for (auto It = ObjectToEntryIndices.CreateKeyIterator(WeakObject); It; ++It)
+	{
+		const int32 EntryIndex = It.Value();
+		FEntry& Entry = Entries[EntryIndex];
+
+		Entry.UnresolvedObjects.RemoveSingleSwap(WeakObject, /* bAllowShrinking */ false);
+		if (Entry.UnresolvedObjects.Num() == 0)
+		{
+			OutResolvedHandles.FindOrAdd(Entry.Key.ChannelObjectPair).Add(Entry.Key.Handle);
+			KeyToEntryIndex.Remove(Entry.Key);
+			ReleaseEntry(EntryIndex);
+		}
+	}
+
+	ObjectToEntryIndices.Remove(WeakObject);
+}
+
+bool FUnresolvedObjectsTracker::HasPendingUpdate(const FChannelObjectPair& ChannelObjectPair, uint16 Handle) const
+{
+	return KeyToEntryIndex.Contains(FEntryKey{ ChannelObjectPair, Handle });
+}
+
+int32 FUnresolvedObjectsTracker::AllocateEntry()
+{
+	if (FreeEntries.Num() > 0)
+	{
+		return FreeEntries.Pop(/* bAllowShrinking */ false);
+	}
+
+	return Entries.AddDefaulted();
+}
+
+void FUnresolvedObjectsTracker::ReleaseEntry(int32 EntryIndex)
+{
+	FEntry& Entry = Entries[EntryIndex];
+	Entry.Key = FEntryKey{};
+	Entry.UnresolvedObjects.Reset();
+	FreeEntries.Add(EntryIndex);
+}
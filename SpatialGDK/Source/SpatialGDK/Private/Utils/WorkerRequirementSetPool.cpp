@@ -0,0 +1,142 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/WorkerRequirementSetPool.h"
+
+#include "Misc/Crc.h"
+
+#include "Utils/SchemaUtils.h"
+
+namespace
+{
+
+struct FPooledRequirementSet
+{
+	TArray<uint8> Key;
+	WorkerRequirementSetHandle RequirementSet;
+};
+
+struct FPool
+{
+	// Requirement sets bucketed by the CRC of their key.
+	TMap<uint32, TArray<FPooledRequirementSet>> Buckets;
+	int32 Num = 0;
+	int32 PurgeThreshold = 64;
+};
+
+FPool& GetPool()
+{
+	static FPool Pool;
+	return Pool;
+}
+
+// Key format: for each attribute set, its attribute count followed by each attribute as a length and its UTF-8 bytes.
+void AppendToKey(TArray<uint8>& Key, const void* Data, uint32 NumBytes)
+{
+	Key.Append(static_cast<const uint8*>(Data), NumBytes);
+}
+
+void AppendToKey(TArray<uint8>& Key, uint32 Value)
+{
+	AppendToKey(Key, &Value, sizeof(Value));
+}
+
+void BuildKey(TArray<uint8>& Key, const WorkerRequirementSet& RequirementSet)
+{
+	for (const WorkerAttributeSet& AttributeSet : RequirementSet)
+	{
+		AppendToKey(Key, static_cast<uint32>(AttributeSet.Num()));
+		for (const FString& Attribute : AttributeSet)
+		{
+			FTCHARToUTF8 UTF8Attribute(*Attribute);
+			AppendToKey(Key, static_cast<uint32>(UTF8Attribute.Length()));
+			AppendToKey(Key, UTF8Attribute.Get(), UTF8Attribute.Length());
+		}
+	}
+}
+
+void BuildKey(TArray<uint8>& Key, Schema_Object* RequirementSetObject)
+{
+	uint32 AttributeSetCount = Schema_GetObjectCount(RequirementSetObject, 1);
+	for (uint32 i = 0; i < AttributeSetCount; i++)
+	{
+		Schema_Object* AttributeSetObject = Schema_IndexObject(RequirementSetObject, 1, i);
+
+		uint32 AttributeCount = Schema_GetBytesCount(AttributeSetObject, 1);
+		AppendToKey(Key, AttributeCount);
+		for (uint32 j = 0; j < AttributeCount; j++)
+		{
+			uint32 AttributeLength = Schema_IndexBytesLength(AttributeSetObject, 1, j);
+			AppendToKey(Key, AttributeLength);
+			AppendToKey(Key, Schema_IndexBytes(AttributeSetObject, 1, j), AttributeLength);
+		}
+	}
+}
+
+template <typename CreateFunc>
+WorkerRequirementSetHandle FindOrAdd(const TArray<uint8>& Key, CreateFunc&& Create)
+{
+	FPool& Pool = GetPool();
+
+	TArray<FPooledRequirementSet>& Bucket = Pool.Buckets.FindOrAdd(FCrc::MemCrc32(Key.GetData(), Key.Num()));
+	for (const FPooledRequirementSet& Pooled : Bucket)
+	{
+		if (Pooled.Key == Key)
+		{
+			return Pooled.RequirementSet;
+		}
+	}
+
+	WorkerRequirementSetHandle RequirementSet = MakeShared<const WorkerRequirementSet>(Create());
+	Bucket.Add(FPooledRequirementSet{ Key, RequirementSet });
+	Pool.Num++;
+
+	// Owning client sets are unique per client, so periodically drop the ones no ACL uses any more.
+	if (Pool.Num > Pool.PurgeThreshold)
+	{
+		FWorkerRequirementSetPool::Purge();
+		Pool.PurgeThreshold = FMath::Max(64, Pool.Num * 2);
+	}
+
+	return RequirementSet;
+}
+
+} // anonymous namespace
+
+WorkerRequirementSetHandle FWorkerRequirementSetPool::Intern(const WorkerRequirementSet& RequirementSet)
+{
+	static TArray<uint8> Key;
+	Key.Reset();
+	BuildKey(Key, RequirementSet);
+
+	return FindOrAdd(Key, [&RequirementSet]() { return RequirementSet; });
+}
+
+WorkerRequirementSetHandle FWorkerRequirementSetPool::InternFromSchema(Schema_Object* Object, Schema_FieldId Id)
+{
+	static TArray<uint8> Key;
+	Key.Reset();
+	BuildKey(Key, Schema_GetObject(Object, Id));
+
+	return FindOrAdd(Key, [Object, Id]() { return SpatialGDK::GetWorkerRequirementSetFromSchema(Object, Id); });
+}
+
+void FWorkerRequirementSetPool::Purge()
+{
+	FPool& Pool = GetPool();
+
+	for (auto It = Pool.Buckets.CreateIterator(); It; ++It)
+	{
+		TArray<FPooledRequirementSet>& Bucket = It.Value();
+		Pool.Num -= Bucket.RemoveAllSwap([](const FPooledRequirementSet& Pooled) { return Pooled.RequirementSet.IsUnique(); });
+
+		if (Bucket.Num() == 0)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+int32 FWorkerRequirementSetPool::Num()
+{
+	return GetPool().Num;
+}
@@ -11,6 +11,7 @@
 #include "Runtime/Launch/Resources/Version.h"
 #include "Schema/StandardLibrary.h"
 #include "SpatialCommonTypes.h"
+#include "Utils/PositionUpdatePolicy.h"
 #include "Utils/RepDataUtils.h"
 
 #include <WorkerSDK/improbable/c_worker.h>
@@ -140,10 +141,16 @@ public:
 
 	FVector GetActorSpatialPosition(AActor* Actor);
 
+	// The connection and worker attribute of the client owning this channel's actor, found by walking up its owner chain.
+	// On servers the result is cached until InvalidateOwnerCache is called, which USpatialNetDriver::OnOwnerUpdated does for every actor
+	// whose owner chain changed. Clients don't get notified about owner changes, so they always walk the chain.
+	UNetConnection* GetOwnerNetConnection();
+	const FString& GetOwnerWorkerAttribute();
+	void InvalidateOwnerCache();
+
 	void RemoveRepNotifiesWithUnresolvedObjs(TArray<UProperty*>& RepNotifies, const FRepLayout& RepLayout, const FObjectReferencesMap& RefMap, UObject* Object);
 	
 	void UpdateShadowData();
-	void UpdateSpatialPositionWithFrequencyCheck();
 	void UpdateSpatialPosition();
 
 	void ServerProcessOwnershipChange();
@@ -176,6 +183,8 @@ private:
 	
 	void UpdateEntityACLToNewOwner();
 
+	void ResolveOwnerCache();
+
 public:
 	// If this actor channel is responsible for creating a new entity, this will be set to true once the entity is created.
 	bool bCreatedEntity;
@@ -194,6 +203,13 @@ private:
 	// Used on the server to track when the owner changes.
 	FString SavedOwnerWorkerAttribute;
 
+	// Used on the server to avoid walking the owner chain every time the owner of this channel's actor is needed, see GetOwnerNetConnection.
+	bool bOwnerCacheValid;
+	TWeakObjectPtr<UNetConnection> CachedOwnerConnection;
+	FString CachedOwnerWorkerAttribute;
+	// The actor GetActorSpatialPosition takes the position of this channel's actor from.
+	TWeakObjectPtr<AActor> CachedPositionActor;
+
 	UPROPERTY(transient)
 	USpatialNetDriver* NetDriver;
 
@@ -205,6 +221,7 @@ private:
 
 	FVector LastPositionSinceUpdate;
 	float TimeWhenPositionLastUpdated;
+	FPositionUpdatePolicy PositionUpdatePolicy;
 
 	// Shadow data for Handover properties.
 	// For each object with handover properties, we store a blob of memory which contains
@@ -45,13 +45,14 @@ public:
 	///////
 	// End NetConnection Interface
 
-	void InitHeartbeat(class FTimerManager* InTimerManager, Worker_EntityId InPlayerControllerEntity);
-	void SetHeartbeatTimeoutTimer();
-	void SetHeartbeatEventTimer();
-
+	void InitHeartbeat(Worker_EntityId InPlayerControllerEntity);
 	void DisableHeartbeat();
 
-	void OnHeartbeat();
+	// Clients only send a heartbeat event when they haven't sent anything else to their PlayerController entity for a heartbeat interval,
+	// since servers treat any client update on it as a heartbeat.
+	void ClientTickHeartbeat();
+	void ClientOnUpdateSent(Worker_EntityId EntityId);
+
 	void UpdateActorInterest(AActor* Actor);
 
 	void ClientNotifyClientHasQuit();
@@ -62,9 +63,7 @@ public:
 	UPROPERTY()
 	FString WorkerAttribute;
 
-	class FTimerManager* TimerManager;
-
 	// Player lifecycle
 	Worker_EntityId PlayerControllerEntity;
-	FTimerHandle HeartbeatTimer;
+	double LastHeartbeatSentTime;
 };
@@ -37,6 +37,8 @@ class ASpatialMetricsDisplay;
 
 class UEntityPool;
 
+class FRPCParameterCodec;
+
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatialOSNetDriver, Log, All);
 
 DECLARE_STATS_GROUP(TEXT("SpatialNet"), STATGROUP_SpatialNet, STATCAT_Advanced);
@@ -68,6 +70,7 @@ public:
 	virtual void TickFlush(float DeltaTime) override;
 	virtual bool IsLevelInitializedForActor(const AActor* InActor, const UNetConnection* InConnection) const override;
 	virtual void NotifyActorDestroyed(AActor* Actor, bool IsSeamlessTravel = false) override;
+	virtual bool ShouldClientDestroyActor(AActor* Actor) const override;
 	virtual void Shutdown() override;
 	// End UNetDriver interface.
 
@@ -100,6 +103,10 @@ public:
 	USpatialActorChannel* GetActorChannelByEntityId(Worker_EntityId EntityId) const;
 	USpatialActorChannel* CreateSpatialActorChannel(AActor* Actor, USpatialNetConnection* InConnection);
 
+	// Returns the distance to the closest view target of the clients this server has authority over, or 0 if there are none.
+	// View targets are gathered once per tick, see UpdateViewerLocations.
+	float GetDistanceToNearestViewer(const FVector& Location) const;
+
 	DECLARE_DELEGATE(PostWorldWipeDelegate);
 
 	void WipeWorld(const USpatialNetDriver::PostWorldWipeDelegate& LoadSnapshotAfterWorldWipe);
@@ -165,6 +172,8 @@ public:
 
 	void DelayedSendDeleteEntityRequest(Worker_EntityId EntityId, float Delay);
 
+	TSharedPtr<FRPCParameterCodec> GetRPCParameterCodec(UFunction* Function);
+
 #if WITH_EDITOR
 	// We store the PlayInEditorID associated with this NetDriver to handle replace a worker initialization when in the editor.
 	int32 PlayInEditorID;
@@ -175,6 +184,12 @@ private:
 
 	TMap<Worker_EntityId_Key, USpatialActorChannel*> EntityToActorChannel;
 	TArray<Worker_OpList*> QueuedStartupOpLists;
+	// Reused every tick to receive the op lists from the connection.
+	TArray<Worker_OpList*> OpListsToProcess;
+	// Locations of the view targets of client connections, updated before replicating Actors each tick.
+	TArray<FVector> ViewerLocations;
+
+	TMap<TWeakObjectPtr<UFunction>, TSharedPtr<FRPCParameterCodec>> RPCParameterCodecs;
 
 	FTimerManager TimerManager;
 
@@ -217,6 +232,8 @@ private:
 #endif
 
 	void ProcessRPC(AActor* Actor, UObject* SubObject, UFunction* Function, void* Parameters);
+	void InvalidateOwnerCache(AActor* Actor);
+	void UpdateViewerLocations();
 
 	friend USpatialNetConnection;
 	friend USpatialWorkerConnection;
@@ -56,7 +56,13 @@ public:
 
 	virtual bool SerializeObject(FArchive& Ar, UClass* InClass, UObject*& Obj, FNetworkGUID *OutNetGUID = NULL) override;
 
+	// Starts loading the package of a stably named object asynchronously if it isn't loaded yet. Returns true while the package is loading,
+	// in which case the ref should be treated as unresolved. Pending operations depending on it are resolved once the package has loaded.
+	bool TryAsyncLoadStablyNamedObject(const FNetworkGUID& NetGUID, const FUnrealObjectRef& ObjectRef);
+
 private:
+	void OnStablyNamedObjectPackageLoaded(const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result);
+
 	UPROPERTY()
 	USpatialClassInfoManager* ClassInfoManager;
 
@@ -65,6 +71,9 @@ private:
 
 	// Entities that have been assigned on this server and not created yet
 	TSet<Worker_EntityId_Key> PendingCreationEntityIds;
+
+	// Stably named object refs waiting on their package to finish loading.
+	TMap<FName, TArray<FUnrealObjectRef>> AsyncLoadingPackages;
 };
 
 class SPATIALGDK_API FSpatialNetGUIDCache : public FNetGUIDCache
@@ -1,9 +1,11 @@
 // Copyright (c) Improbable Worlds Ltd, All Rights Reserved
 #pragma once
 
+#include "Containers/CircularQueue.h"
 #include "Containers/Queue.h"
 #include "HAL/Runnable.h"
 #include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
 
 #include "Interop/Connection/ConnectionConfig.h"
 #include "Interop/Connection/OutgoingMessages.h"
@@ -27,6 +29,18 @@ enum class SpatialConnectionType
 	Locator
 };
 
+// How the queue of op lists waiting for the game thread behaved since the stats were last taken.
+struct FOpListQueueStats
+{
+	int32 NumOpLists = 0;
+	int32 MaxDepth = 0;
+	// Time between an op list being received from the worker SDK and being handed to the game thread.
+	double TotalDwellTime = 0.0;
+	double MaxDwellTime = 0.0;
+	// Number of times the ops thread found the queue full.
+	int32 NumTimesFull = 0;
+};
+
 UCLASS()
 class SPATIALGDK_API USpatialWorkerConnection : public UObject, public FRunnable
 {
@@ -43,7 +57,9 @@ public:
 	FORCEINLINE bool IsConnected() { return bIsConnected; }
 
 	// Worker Connection Interface
-	TArray<Worker_OpList*> GetOpList();
+	// Moves the op lists received since the last call into OutOpLists, which is reset first so its allocation can be reused every frame.
+	void GetOpList(TArray<Worker_OpList*>& OutOpLists);
+	FOpListQueueStats TakeOpListQueueStats();
 	Worker_RequestId SendReserveEntityIdsRequest(uint32_t NumOfEntities);
 	Worker_RequestId SendCreateEntityRequest(TArray<Worker_ComponentData>&& Components, const Worker_EntityId* EntityId);
 	Worker_RequestId SendDeleteEntityRequest(Worker_EntityId EntityId);
@@ -87,6 +103,7 @@ private:
 
 	void InitializeOpsProcessingThread();
 	void QueueLatestOpList();
+	void DestroyQueuedOpLists();
 	void ProcessOutgoingMessages();
 
 	void StartDevelopmentAuth(FString DevAuthToken);
@@ -110,7 +127,19 @@ private:
 	FThreadSafeBool KeepRunning = true;
 	float OpsUpdateInterval;
 
-	TQueue<Worker_OpList*> OpListQueue;
+	struct FQueuedOpList
+	{
+		Worker_OpList* OpList;
+		double QueueTime;
+	};
+
+	// Filled by the ops thread and drained by the game thread.
+	TUniquePtr<TCircularQueue<FQueuedOpList>> OpListQueue;
+	// Only used by the ops thread, for op lists that didn't fit into OpListQueue when bLeaveOpsInSDKWhenOpListQueueFull is disabled.
+	TQueue<FQueuedOpList, EQueueMode::Spsc> OverflowOpLists;
+	bool bLeaveOpsInSDKWhenQueueFull;
+	FThreadSafeCounter OpListQueueFullCount;
+	FOpListQueueStats OpListQueueStats;
 	TQueue<TUniquePtr<SpatialGDK::FOutgoingMessage>> OutgoingMessagesQueue;
 
 	// RequestIds per worker connection start at 0 and incrementally go up each command sent.
@@ -6,6 +6,7 @@
 #include "TimerManager.h"
 #include "UObject/NoExportTypes.h"
 
+#include "SpatialCommonTypes.h"
 #include "Utils/SchemaUtils.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
@@ -89,6 +90,9 @@ public:
 #endif // WITH_EDITOR
 private:
 	void LinkExistingSingletonActor(const UClass* SingletonClass);
+	void LinkExistingSingletonActor(const UClass* SingletonClass, Worker_EntityId SingletonEntityId);
+	void SetSingletonNameToEntityId(StringToEntityMap&& NewSingletonNameToEntityId);
+	UClass* GetSingletonClass(const FString& ClassPath);
 	void ApplyAcceptingPlayersUpdate(bool bAcceptingPlayersUpdate);
 	void ApplyCanBeginPlayUpdate(const bool bCanBeginPlayUpdate);
 
@@ -113,4 +117,10 @@ private:
 	USpatialReceiver* Receiver;
 
 	FTimerManager* TimerManager;
+
+	// Singleton classes resolved from the paths in SingletonNameToEntityId, so they are only loaded once.
+	TMap<FString, TWeakObjectPtr<UClass>> SingletonClasses;
+	// Entries of SingletonNameToEntityId that changed since LinkAllExistingSingletonActors last ran.
+	TSet<FString> SingletonsToLink;
+	TSet<Worker_EntityId_Key> SingletonEntityIds;
 };
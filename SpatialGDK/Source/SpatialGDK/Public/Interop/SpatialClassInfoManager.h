@@ -68,6 +68,21 @@ struct FClassInfo
 	// Only for Actors
 	TMap<uint32, TSharedRef<const FClassInfo>> SubobjectInfo;
 
+	// Only for Actors. Persistent id of the class in the schema database, 0 if schema was generated before it had one.
+	uint32 ClassId = 0;
+
+	// Only for Actors. Components holding the Actor's user-defined property groups.
+	TArray<Worker_ComponentId> PropertyGroupComponents;
+
+	// Only for Actors. Indexed by rep handle - 1, the property group component the handle is replicated in.
+	// Handles outside of property groups (and past the end of the array) use the SCHEMA_Data component.
+	TArray<Worker_ComponentId> HandleToPropertyGroupComponent;
+
+	FORCEINLINE Worker_ComponentId GetPropertyGroupComponent(uint16 Handle) const
+	{
+		return Handle > 0 && Handle <= HandleToPropertyGroupComponent.Num() ? HandleToPropertyGroupComponent[Handle - 1] : SpatialConstants::INVALID_COMPONENT_ID;
+	}
+
 	// Only for default Subobjects belonging to Actors
 	FName SubobjectName;
 
@@ -101,6 +116,12 @@ public:
 	const FClassInfo& GetClassInfoByComponentId(Worker_ComponentId ComponentId);
 
 	UClass* GetClassByComponentId(Worker_ComponentId ComponentId);
+
+	// Returns the Actor class identified by ClassId, see USchemaDatabase::ActorClassPathToClassId. Resolved classes are kept in a table
+	// indexed by ClassId, so spawning entities doesn't have to look up class paths.
+	UClass* GetActorClassByClassId(uint32 ClassId, bool bAllowLoad);
+	// Returns the path of the Actor class identified by ClassId, or nullptr if it isn't in the schema database.
+	const FString* GetActorClassPathByClassId(uint32 ClassId) const;
 	bool GetOffsetByComponentId(Worker_ComponentId ComponentId, uint32& OutOffset);
 	ESchemaComponentType GetCategoryByComponentId(Worker_ComponentId ComponentId);
 
@@ -112,6 +133,11 @@ public:
 	uint32 GetComponentIdFromLevelPath(const FString& LevelPath);
 	bool IsSublevelComponent(Worker_ComponentId ComponentId);
 
+	// Component ids of the user-defined property groups of all Actor classes, by group name.
+	const TMap<FName, TArray<Worker_ComponentId>>& GetPropertyGroupComponentIds() const { return PropertyGroupComponentIds; }
+	// All generated components clients may check out outside of property groups, including sublevel components. Handover components are left out.
+	TArray<Worker_ComponentId> GetComponentIdsOutsidePropertyGroups() const;
+
 	UPROPERTY()
 	USchemaDatabase* SchemaDatabase;
 
@@ -135,4 +161,10 @@ private:
 	TMap<Worker_ComponentId, TSharedRef<FClassInfo>> ComponentToClassInfoMap;
 	TMap<Worker_ComponentId, uint32> ComponentToOffsetMap;
 	TMap<Worker_ComponentId, ESchemaComponentType> ComponentToCategoryMap;
+
+	// Both indexed by ClassId - 1.
+	TArray<TWeakObjectPtr<UClass>> ClassIdToActorClass;
+	TArray<FString> ClassIdToClassPath;
+
+	TMap<FName, TArray<Worker_ComponentId>> PropertyGroupComponentIds;
 };
@@ -14,6 +14,9 @@
 #include "Schema/StandardLibrary.h"
 #include "Schema/UnrealObjectRef.h"
 #include "SpatialCommonTypes.h"
+#include "Utils/ActorPool.h"
+#include "Utils/ComponentParser.h"
+#include "Utils/HeartbeatTracker.h"
 #include "Utils/RPCContainer.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
@@ -36,6 +39,17 @@ struct PendingAddComponentWrapper
 	Worker_EntityId EntityId;
 	Worker_ComponentId ComponentId;
 	TUniquePtr<SpatialGDK::DynamicComponent> Data;
+	TUniquePtr<SpatialGDK::ParsedComponentData> ParsedData;
+};
+
+// Initial ops of an entity whose class is being loaded asynchronously. They are replayed once the class has loaded.
+struct FEntityWaitingForAsyncLoad
+{
+	FName PackageName;
+	TArray<PendingAddComponentWrapper> PendingAddComponents;
+	TArray<Worker_AuthorityChangeOp> PendingAuthorityChanges;
+	// Acquired from the op list they were received in, released once they have been applied.
+	TArray<Worker_ComponentUpdate*> PendingComponentUpdates;
 };
 
 struct FObjectReferences
@@ -129,6 +143,7 @@ public:
 	void HandleRPC(const Worker_ComponentUpdateOp& Op);
 
 	void ProcessRPCEventField(Worker_EntityId EntityId, const Worker_ComponentUpdateOp &Op, const Worker_ComponentId RPCEndpointComponentId, bool bPacked);
+	void ProcessRPCEvent(const Worker_ComponentUpdateOp& Op, Worker_ComponentId RPCEndpointComponentId, const FUnrealObjectRef& ObjectRef, SpatialGDK::RPCPayload&& Payload, bool bPacked);
 
 	void OnCommandRequest(const Worker_CommandRequestOp& Op);
 	void OnCommandResponse(const Worker_CommandResponseOp& Op);
@@ -138,6 +153,7 @@ public:
 
 	void AddPendingActorRequest(Worker_RequestId RequestId, USpatialActorChannel* Channel);
 	void AddPendingReliableRPC(Worker_RequestId RequestId, TSharedRef<struct FReliableRPCForRetry> ReliableRPC);
+	void AddPendingReliableRPCBatch(Worker_RequestId RequestId, TArray<TSharedRef<struct FReliableRPCForRetry>>&& ReliableRPCs);
 
 	void AddEntityQueryDelegate(Worker_RequestId RequestId, EntityQueryDelegate Delegate);
 	void AddReserveEntityIdsDelegate(Worker_RequestId RequestId, ReserveEntityIDsDelegate Delegate);
@@ -152,11 +168,26 @@ public:
 
 	void OnDisconnect(Worker_DisconnectOp& Op);
 
+	// Disconnects clients that haven't sent a heartbeat or RPC to their PlayerController within the heartbeat timeout.
+	void CheckClientHeartbeats();
+
+	// True while the Actor's channel is being cleaned up before the Actor is returned to the client Actor pool.
+	bool IsRecyclingActor(const AActor* Actor) const { return Actor != nullptr && Actor == RecyclingActor; }
+
 private:
 	void EnterCriticalSection();
 	void LeaveCriticalSection();
+	void ParsePendingAddComponents();
+
+	bool NeedToLoadClass(SpatialGDK::UnrealMetadata* UnrealMetadata, FString& OutClassPath);
+	void StartAsyncLoadingClass(Worker_EntityId EntityId, const FString& ClassPath);
+	void OnAsyncPackageLoaded(const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result);
+	void ReceiveEntityLoadedAsync(Worker_EntityId EntityId);
+	void DiscardEntityWaitingForAsyncLoad(Worker_EntityId EntityId);
 
-	void ReceiveActor(Worker_EntityId EntityId);
+	// Creates the Actor for a received entity and registers it with the package map. Returns the new Actor's channel, which still needs its initial state applied.
+	USpatialActorChannel* ReceiveActor(Worker_EntityId EntityId);
+	void ApplyInitialActorState(Worker_EntityId EntityId, USpatialActorChannel* Channel);
 	void RemoveActor(Worker_EntityId EntityId);
 	void DestroyActor(AActor* Actor, Worker_EntityId EntityId);
 
@@ -172,8 +203,8 @@ private:
 	void HandlePlayerLifecycleAuthority(const Worker_AuthorityChangeOp& Op, class APlayerController* PlayerController);
 	void HandleActorAuthority(const Worker_AuthorityChangeOp& Op);
 
-	void ApplyComponentDataOnActorCreation(Worker_EntityId EntityId, const Worker_ComponentData& Data, USpatialActorChannel* Channel);
-	void ApplyComponentData(UObject* TargetObject, USpatialActorChannel* Channel, const Worker_ComponentData& Data);
+	void ApplyComponentDataOnActorCreation(Worker_EntityId EntityId, const Worker_ComponentData& Data, USpatialActorChannel* Channel, SpatialGDK::ParsedComponentData* ParsedData = nullptr);
+	void ApplyComponentData(UObject* TargetObject, USpatialActorChannel* Channel, const Worker_ComponentData& Data, SpatialGDK::ParsedComponentData* ParsedData = nullptr);
 	// This is called for AddComponentOps not in a critical section, which means they are not a part of the initial entity creation.
 	void HandleIndividualAddComponent(const Worker_AddComponentOp& Op);
 	void AttachDynamicSubobject(Worker_EntityId EntityId, const FClassInfo& Info);
@@ -183,7 +214,9 @@ private:
 	bool ApplyRPC(const FPendingRPCParams& Params);
 	bool ApplyRPC(UObject* TargetObject, UFunction* Function, const SpatialGDK::RPCPayload& Payload, const FString& SenderWorkerId, bool bApplyWithUnresolvedRefs = false);	
 
+	void ReceiveCrossServerRPC(Worker_EntityId EntityId, SpatialGDK::RPCPayload&& Payload);
 	void ReceiveCommandResponse(const Worker_CommandResponseOp& Op);
+	void HandleReliableRPCResponse(const TSharedRef<struct FReliableRPCForRetry>& ReliableRPC, const Worker_CommandResponseOp& Op);
 
 	bool IsReceivedEntityTornOff(Worker_EntityId EntityId);
 
@@ -199,7 +232,8 @@ private:
 	void ResolveObjectReferences(FRepLayout& RepLayout, UObject* ReplicatedObject, FObjectReferencesMap& ObjectReferencesMap, uint8* RESTRICT StoredData, uint8* RESTRICT Data, int32 MaxAbsOffset, TArray<UProperty*>& RepNotifies, bool& bOutSomeObjectsWereMapped, bool& bOutStillHasUnresolved);
 
 	void ProcessQueuedResolvedObjects();
-	void ProcessQueuedActorRPCsOnEntityCreation(AActor* Actor, SpatialGDK::RPCsOnEntityCreation& QueuedRPCs);
+	void ProcessQueuedActorRPCsOnEntityCreation(AActor* Actor, SpatialGDK::RPCsOnEntityCreation& QueuedRPCs, uint32 FirstRPCIndex);
+	void ClearAcknowledgedRPCsOnEntityCreation(const Worker_ComponentUpdateOp& Op);
 	void UpdateShadowData(Worker_EntityId EntityId);
 	TWeakObjectPtr<USpatialActorChannel> PopPendingActorRequest(Worker_RequestId RequestId);
 
@@ -235,6 +269,9 @@ private:
 
 	// TODO: Figure out how to remove entries when Channel/Actor gets deleted - UNR:100
 	TMap<FChannelObjectPair, FObjectReferencesMap> UnresolvedRefsMap;
+
+	// Reused to parse every component update, so its field array isn't reallocated for each one.
+	SpatialGDK::ParsedComponentData ParsedUpdateScratch;
 	TArray<TPair<UObject*, FUnrealObjectRef>> ResolvedObjectQueue;
 
 	TMap<FUnrealObjectRef, FIncomingRPCArray> IncomingRPCMap;
@@ -246,8 +283,15 @@ private:
 	TArray<PendingAddComponentWrapper> PendingAddComponents;
 	TArray<Worker_RemoveComponentOp> QueuedRemoveComponentOps;
 
+	TMap<Worker_EntityId_Key, FEntityWaitingForAsyncLoad> EntitiesWaitingForAsyncLoad;
+	TMap<FName, TArray<Worker_EntityId>> AsyncLoadingPackages;
+	// Entities whose package finished loading while in a critical section. They are received once it is left.
+	TArray<Worker_EntityId> EntitiesLoadedAsyncInCriticalSection;
+
 	TMap<Worker_RequestId, TWeakObjectPtr<USpatialActorChannel>> PendingActorRequests;
 	FReliableRPCMap PendingReliableRPCs;
+	// Reliable RPCs sent as part of a batched CrossServer RPC command.
+	TMap<Worker_RequestId, TArray<TSharedRef<struct FReliableRPCForRetry>>> PendingReliableRPCBatches;
 
 	TMap<Worker_RequestId, EntityQueryDelegate> EntityQueryDelegates;
 	TMap<Worker_RequestId, ReserveEntityIDsDelegate> ReserveEntityIDsDelegates;
@@ -257,6 +301,10 @@ private:
 	// for PlayerControllers that this server has authority over. This is used for player
 	// lifecycle logic (Heartbeat component updates, disconnection logic).
 	TMap<Worker_EntityId_Key, TWeakObjectPtr<USpatialNetConnection>> AuthorityPlayerControllerConnectionMap;
+	FHeartbeatTracker ClientHeartbeats;
 
 	TMap<TPair<Worker_EntityId_Key, Worker_ComponentId>, PendingAddComponentWrapper> PendingDynamicSubobjectComponents;
+
+	FActorPool ActorPool;
+	AActor* RecyclingActor = nullptr;
 };
@@ -10,6 +10,7 @@
 #include "TimerManager.h"
 #include "Utils/RepDataUtils.h"
 #include "Utils/RPCContainer.h"
+#include "Utils/UnresolvedObjectsTracker.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
 #include <WorkerSDK/improbable/c_worker.h>
@@ -55,14 +56,16 @@ struct FPendingRPC
 	Schema_EntityId Entity;
 };
 
+struct FPendingCrossServerRPCBatch
+{
+	TArray<FPendingRPC> RPCs;
+	// Reliable RPCs of the batch, which are retried individually if the batch command fails.
+	TArray<TSharedRef<FReliableRPCForRetry>> ReliableRPCs;
+};
+
 // TODO: Clear TMap entries when USpatialActorChannel gets deleted - UNR:100
 // care for actor getting deleted before actor channel
-using FChannelObjectPair = TPair<TWeakObjectPtr<USpatialActorChannel>, TWeakObjectPtr<UObject>>;
 using FRPCsOnEntityCreationMap = TMap<TWeakObjectPtr<const UObject>, RPCsOnEntityCreation>;
-using FUnresolvedEntry = TSharedPtr<TSet<TWeakObjectPtr<const UObject>>>;
-using FHandleToUnresolved = TMap<uint16, FUnresolvedEntry>;
-using FChannelToHandleToUnresolved = TMap<FChannelObjectPair, FHandleToUnresolved>;
-using FOutgoingRepUpdates = TMap<TWeakObjectPtr<const UObject>, FChannelToHandleToUnresolved>;
 using FUpdatesQueuedUntilAuthority = TMap<Worker_EntityId_Key, TArray<Worker_ComponentUpdate>>;
 using FChannelsToUpdatePosition = TSet<TWeakObjectPtr<USpatialActorChannel>>;
 
@@ -88,7 +91,6 @@ public:
 	void SendCreateEntityRequest(USpatialActorChannel* Channel);
 	void SendDeleteEntityRequest(Worker_EntityId EntityId);
 
-	void SendRequestToClearRPCsOnEntityCreation(Worker_EntityId EntityId);
 	void ClearRPCsOnEntityCreation(Worker_EntityId EntityId);
 
 	void SendClientEndpointReadyUpdate(Worker_EntityId EntityId);
@@ -112,6 +114,8 @@ public:
 	void ProcessUpdatesQueuedUntilAuthority(Worker_EntityId EntityId);
 
 	void FlushPackedRPCs();
+	void FlushBatchedRPCs();
+	void FlushCrossServerRPCs();
 
 	RPCPayload CreateRPCPayloadFromParams(UObject* TargetObject, UFunction* Function, int ReliableRPCIndex, void* Params, TSet<TWeakObjectPtr<const UObject>>& UnresolvedObjects);
 	void GainAuthorityThenAddComponent(USpatialActorChannel* Channel, UObject* Object, const FClassInfo* Info);
@@ -126,7 +130,7 @@ private:
 
 	// Queuing
 	void ResetOutgoingUpdate(USpatialActorChannel* DependentChannel, UObject* ReplicatedObject, int16 Handle, bool bIsHandover);
-	void QueueOutgoingUpdate(USpatialActorChannel* DependentChannel, UObject* ReplicatedObject, int16 Handle, const TSet<TWeakObjectPtr<const UObject>>& UnresolvedObjects, bool bIsHandover);
+	void QueueOutgoingUpdate(USpatialActorChannel* DependentChannel, UObject* ReplicatedObject, int16 Handle, const FUnresolvedObjectsSet& UnresolvedObjects, bool bIsHandover);
 
 	// RPC Construction
 	FSpatialNetBitWriter PackRPCDataToSpatialNetBitWriter(UFunction* Function, void* Parameters, int ReliableRPCId, TSet<TWeakObjectPtr<const UObject>>& UnresolvedObjects) const;
@@ -135,6 +139,11 @@ private:
 	Worker_CommandRequest CreateRetryRPCCommandRequest(const FReliableRPCForRetry& RPC, uint32 TargetObjectOffset);
 	Worker_ComponentUpdate CreateRPCEventUpdate(UObject* TargetObject, const RPCPayload& Payload, Worker_ComponentId ComponentId, Schema_FieldId EventIndex, const UObject*& OutUnresolvedObject);
 	bool AddPendingRPC(UObject* TargetObject, const FPendingRPCParams& Parameters, Worker_ComponentId ComponentId, Schema_FieldId RPCIndex, const UObject*& OutUnresolvedObject);
+	void AddRPCOnEntityCreation(UObject* TargetObject, UFunction* Function, const RPCPayload& Payload);
+	bool AddBatchedRPC(UObject* TargetObject, const RPCPayload& Payload, Worker_ComponentId ComponentId, const UObject*& OutUnresolvedObject);
+	bool AddCrossServerRPCToBatch(UObject* TargetObject, UFunction* Function, const RPCPayload& Payload, Worker_ComponentId ComponentId, const UObject*& OutUnresolvedObject);
+	void OnClientRPCUpdateSent(Worker_EntityId EntityId);
+	void AddRPCBatchEvent(Schema_Object* EventsObject, Schema_FieldId EventId, const TArray<FPendingRPC>& RPCs, bool bPacked);
 
 	TArray<Worker_InterestOverride> CreateComponentInterestForActor(USpatialActorChannel* Channel, bool bIsNetOwned);
 
@@ -162,11 +171,8 @@ private:
 
 	FTimerManager* TimerManager;
 
-	FChannelToHandleToUnresolved RepPropertyToUnresolved;
-	FOutgoingRepUpdates RepObjectToUnresolved;
-
-	FChannelToHandleToUnresolved HandoverPropertyToUnresolved;
-	FOutgoingRepUpdates HandoverObjectToUnresolved;
+	FUnresolvedObjectsTracker RepUnresolvedTracker;
+	FUnresolvedObjectsTracker HandoverUnresolvedTracker;
 
 	FRPCContainer OutgoingRPCs;
 	FRPCsOnEntityCreationMap OutgoingOnCreateEntityRPCs;
@@ -180,4 +186,10 @@ private:
 	FChannelsToUpdatePosition ChannelsToUpdatePosition;
 
 	TMap<Worker_EntityId_Key, TArray<FPendingRPC>> RPCsToPack;
+
+	// RPCs sent on their target's own endpoints this frame, per entity and endpoint component, when bBatchRPCEvents is set.
+	TMap<Worker_EntityId_Key, TMap<Worker_ComponentId, TArray<FPendingRPC>>> RPCsToBatch;
+
+	// CrossServer RPCs sent this frame, per target entity, when bBatchCrossServerRPCs is set.
+	TMap<Worker_EntityId_Key, FPendingCrossServerRPCBatch> CrossServerRPCsToBatch;
 };
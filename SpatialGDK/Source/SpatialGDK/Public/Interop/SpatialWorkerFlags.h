@@ -8,6 +8,45 @@
 DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnWorkerFlagsUpdatedBP, FString, FlagName, FString, FlagValue);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnWorkerFlagsUpdated, FString, FlagName, FString, FlagValue);
 
+class FWorkerFlag;
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnWorkerFlagChanged, const FWorkerFlag&);
+
+// Value of a single worker flag, parsed once when the flag is updated so it can be read every tick without string lookups.
+// Obtained through USpatialWorkerFlags::RegisterWorkerFlag, which keeps it alive and updates it in place.
+class SPATIALGDK_API FWorkerFlag
+{
+public:
+	const FString& GetName() const { return Name; }
+	bool IsSet() const { return bIsSet; }
+
+	// Empty when the flag is not set.
+	const FString& GetString() const { return StringValue; }
+
+	// Return the given default when the flag is not set.
+	int32 GetInt(int32 Default = 0) const { return bIsSet ? IntValue : Default; }
+	float GetFloat(float Default = 0.0f) const { return bIsSet ? FloatValue : Default; }
+	bool GetBool(bool Default = false) const { return bIsSet ? bBoolValue : Default; }
+
+	// Broadcast when this flag is set, changed or removed.
+	FOnWorkerFlagChanged& OnChanged() { return OnChangedDelegate; }
+
+private:
+	friend class USpatialWorkerFlags;
+
+	explicit FWorkerFlag(const FString& InName) : Name(InName) {}
+
+	void SetValue(const FString* NewValue);
+
+	FString Name;
+	bool bIsSet = false;
+	FString StringValue;
+	int32 IntValue = 0;
+	float FloatValue = 0.0f;
+	bool bBoolValue = false;
+
+	FOnWorkerFlagChanged OnChangedDelegate;
+};
+
 UCLASS()
 class SPATIALGDK_API USpatialWorkerFlags : public UBlueprintFunctionLibrary
 {
@@ -30,11 +69,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SpatialOS")
 	static void UnbindFromOnWorkerFlagsUpdated(const FOnWorkerFlagsUpdatedBP& InDelegate);
 
+	/** Returns the cached value of a worker flag, which stays valid and is kept up to date for the lifetime of the module.
+	 * Register flags once and keep the reference instead of calling GetWorkerFlag from per-tick code.
+	 */
+	static FWorkerFlag& RegisterWorkerFlag(const FString& Name);
+
 	static FOnWorkerFlagsUpdated OnWorkerFlagsUpdated;
 private:
 	static void ApplyWorkerFlagUpdate(const struct Worker_FlagUpdateOp& Op);
 
 	static TMap<FString, FString> WorkerFlags;
+	static TMap<FString, TUniquePtr<FWorkerFlag>> RegisteredWorkerFlags;
 
 	friend class USpatialDispatcher;
 };
@@ -22,6 +22,7 @@ struct ClientRPCEndpoint : Component
 	{
 		Schema_Object* EndpointObject  = Schema_GetComponentDataFields(Data.schema_type);
 		bReady = GetBoolFromSchema(EndpointObject, SpatialConstants::UNREAL_RPC_ENDPOINT_READY_ID);
+		AckedRPCsOnEntityCreation = Schema_GetUint32(EndpointObject, SpatialConstants::UNREAL_CLIENT_RPC_ENDPOINT_ACKED_RPCS_ON_ENTITY_CREATION_ID);
 	}
 
 	void ApplyComponentUpdate(const Worker_ComponentUpdate& Update)
@@ -31,6 +32,10 @@ struct ClientRPCEndpoint : Component
 		{
 			bReady = GetBoolFromSchema(EndpointObject, SpatialConstants::UNREAL_RPC_ENDPOINT_READY_ID);
 		}
+		if (Schema_GetUint32Count(EndpointObject, SpatialConstants::UNREAL_CLIENT_RPC_ENDPOINT_ACKED_RPCS_ON_ENTITY_CREATION_ID) > 0)
+		{
+			AckedRPCsOnEntityCreation = Schema_GetUint32(EndpointObject, SpatialConstants::UNREAL_CLIENT_RPC_ENDPOINT_ACKED_RPCS_ON_ENTITY_CREATION_ID);
+		}
 	}
 
 	Worker_ComponentData CreateRPCEndpointData()
@@ -40,6 +45,7 @@ struct ClientRPCEndpoint : Component
 		Data.schema_type = Schema_CreateComponentData(ComponentId);
 		Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data.schema_type);
 		Schema_AddBool(ComponentObject, SpatialConstants::UNREAL_RPC_ENDPOINT_READY_ID, bReady);
+		Schema_AddUint32(ComponentObject, SpatialConstants::UNREAL_CLIENT_RPC_ENDPOINT_ACKED_RPCS_ON_ENTITY_CREATION_ID, AckedRPCsOnEntityCreation);
 
 		return Data;
 	}
@@ -51,11 +57,13 @@ struct ClientRPCEndpoint : Component
 		Update.schema_type = Schema_CreateComponentUpdate(ComponentId);
 		Schema_Object* UpdateObject = Schema_GetComponentUpdateFields(Update.schema_type);
 		Schema_AddBool(UpdateObject, SpatialConstants::UNREAL_RPC_ENDPOINT_READY_ID, bReady);
+		Schema_AddUint32(UpdateObject, SpatialConstants::UNREAL_CLIENT_RPC_ENDPOINT_ACKED_RPCS_ON_ENTITY_CREATION_ID, AckedRPCsOnEntityCreation);
 
 		return Update;
 	}
 
 	bool bReady = false;
+	uint32 AckedRPCsOnEntityCreation = 0;
 };
 
 } // namespace SpatialGDK
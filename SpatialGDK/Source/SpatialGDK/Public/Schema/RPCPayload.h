@@ -12,6 +12,42 @@
 namespace SpatialGDK
 {
 
+// Flags stored in the low bits of an RPC header in an UnrealRPCBatch, the payload length is stored above them.
+enum ERPCBatchHeaderFlags : uint64
+{
+	RPC_BATCH_HAS_INDEX = 1 << 0,
+	RPC_BATCH_HAS_OFFSET = 1 << 1,
+	RPC_BATCH_HAS_ENTITY = 1 << 2
+};
+
+// Number of low header bits used by ERPCBatchHeaderFlags.
+constexpr uint32 RPC_BATCH_FLAG_BITS = 3;
+
+inline void AppendVarint(TArray<uint8>& Buffer, uint64 Value)
+{
+	while (Value >= 0x80)
+	{
+		Buffer.Add((uint8)(Value | 0x80));
+		Value >>= 7;
+	}
+	Buffer.Add((uint8)Value);
+}
+
+inline bool ReadVarint(const TArray<uint8>& Buffer, int32& InOutPosition, uint64& OutValue)
+{
+	OutValue = 0;
+	for (uint32 Shift = 0; Shift < 64 && InOutPosition < Buffer.Num(); Shift += 7)
+	{
+		const uint8 Byte = Buffer[InOutPosition++];
+		OutValue |= (uint64)(Byte & 0x7F) << Shift;
+		if ((Byte & 0x80) == 0)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 struct RPCPayload
 {
 	RPCPayload() = delete;
@@ -38,6 +74,62 @@ struct RPCPayload
 		AddBytesToSchema(RPCObject, SpatialConstants::UNREAL_RPC_PAYLOAD_RPC_PAYLOAD_ID, Data, sizeof(uint8) * NumElems);
 	}
 
+	// Appends an RPC to the rpcs field of an UnrealRPCBatch. Index, offset and entity are left out when they are zero,
+	// EntityId is only set for packed RPCs.
+	static void AppendToBatch(TArray<uint8>& Batch, uint32 Offset, uint32 Index, const uint8* Data, int32 NumElems, Worker_EntityId EntityId = 0)
+	{
+		uint64 Header = (uint64)NumElems << RPC_BATCH_FLAG_BITS;
+		Header |= Index != 0 ? RPC_BATCH_HAS_INDEX : 0;
+		Header |= Offset != 0 ? RPC_BATCH_HAS_OFFSET : 0;
+		Header |= EntityId != 0 ? RPC_BATCH_HAS_ENTITY : 0;
+
+		AppendVarint(Batch, Header);
+		if (Index != 0)
+		{
+			AppendVarint(Batch, Index);
+		}
+		if (Offset != 0)
+		{
+			AppendVarint(Batch, Offset);
+		}
+		if (EntityId != 0)
+		{
+			AppendVarint(Batch, (uint64)EntityId);
+		}
+		Batch.Append(Data, NumElems);
+	}
+
+	// Reads the RPC starting at InOutPosition in the rpcs field of an UnrealRPCBatch and moves InOutPosition past it.
+	// Returns false if the batch is malformed.
+	static bool ReadFromBatch(const TArray<uint8>& Batch, int32& InOutPosition, uint32& OutOffset, uint32& OutIndex, TArray<uint8>& OutData, Worker_EntityId& OutEntityId)
+	{
+		uint64 Header = 0;
+		uint64 Index = 0;
+		uint64 Offset = 0;
+		uint64 EntityId = 0;
+
+		if (!ReadVarint(Batch, InOutPosition, Header) ||
+			((Header & RPC_BATCH_HAS_INDEX) && !ReadVarint(Batch, InOutPosition, Index)) ||
+			((Header & RPC_BATCH_HAS_OFFSET) && !ReadVarint(Batch, InOutPosition, Offset)) ||
+			((Header & RPC_BATCH_HAS_ENTITY) && !ReadVarint(Batch, InOutPosition, EntityId)))
+		{
+			return false;
+		}
+
+		const uint64 NumElems = Header >> RPC_BATCH_FLAG_BITS;
+		if (NumElems > (uint64)(Batch.Num() - InOutPosition))
+		{
+			return false;
+		}
+
+		OutIndex = (uint32)Index;
+		OutOffset = (uint32)Offset;
+		OutEntityId = (Worker_EntityId)EntityId;
+		OutData = TArray<uint8>(Batch.GetData() + InOutPosition, (int32)NumElems);
+		InOutPosition += (int32)NumElems;
+		return true;
+	}
+
 	uint32 Offset;
 	uint32 Index;
 	TArray<uint8> PayloadData;
@@ -94,14 +186,6 @@ struct RPCsOnEntityCreation : Component
 		return Update;
 	}
 
-	static Worker_CommandRequest CreateClearFieldsCommandRequest()
-	{
-		Worker_CommandRequest CommandRequest = {};
-		CommandRequest.component_id = ComponentId;
-		CommandRequest.schema_type = Schema_CreateCommandRequest(ComponentId, SpatialConstants::CLEAR_RPCS_ON_ENTITY_CREATION);
-		return CommandRequest;
-	}
-
 	TArray<RPCPayload> RPCs;
 };
 
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "Algo/BinarySearch.h"
 #include "Math/Vector.h"
 
 #include "Schema/Component.h"
@@ -10,6 +11,7 @@
 #include "UObject/UObjectGlobals.h"
 #include "UObject/Package.h"
 #include "Utils/SchemaUtils.h"
+#include "Utils/WorkerRequirementSetPool.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
 #include <WorkerSDK/improbable/c_worker.h>
@@ -67,30 +69,83 @@ inline Coordinates GetCoordinateFromSchema(Schema_Object* Object, Schema_FieldId
 	return Coordinate;
 }
 
-struct EntityAcl : Component
+// Write ACL stored as a small array of handles to pooled requirement sets, sorted by component ID.
+// Mirrors the parts of the WriteAclMap interface that EntityAcl users rely on.
+class SharedWriteAclMap
 {
-	static const Worker_ComponentId ComponentId = SpatialConstants::ENTITY_ACL_COMPONENT_ID;
+public:
+	using FEntry = TPair<Worker_ComponentId, WorkerRequirementSetHandle>;
 
-	EntityAcl() = default;
+	SharedWriteAclMap() = default;
 
-	EntityAcl(const WorkerRequirementSet& InReadAcl, const WriteAclMap& InComponentWriteAcl)
-		: ReadAcl(InReadAcl), ComponentWriteAcl(InComponentWriteAcl) {}
+	SharedWriteAclMap(const WriteAclMap& InMap)
+	{
+		Entries.Reserve(InMap.Num());
+		for (const auto& KVPair : InMap)
+		{
+			Add(KVPair.Key, KVPair.Value);
+		}
+	}
 
-	EntityAcl(const Worker_ComponentData& Data)
+	const WorkerRequirementSet* Find(Worker_ComponentId ComponentId) const
 	{
-		Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data.schema_type);
+		int32 Index = LowerBound(ComponentId);
+		return Index < Entries.Num() && Entries[Index].Key == ComponentId ? &Entries[Index].Value.Get() : nullptr;
+	}
 
-		ReadAcl = GetWorkerRequirementSetFromSchema(ComponentObject, 1);
+	void Add(Worker_ComponentId ComponentId, const WorkerRequirementSet& RequirementSet)
+	{
+		Add(ComponentId, FWorkerRequirementSetPool::Intern(RequirementSet));
+	}
 
-		uint32 KVPairCount = Schema_GetObjectCount(ComponentObject, 2);
-		for (uint32 i = 0; i < KVPairCount; i++)
+	void Add(Worker_ComponentId ComponentId, const WorkerRequirementSetHandle& RequirementSet)
+	{
+		int32 Index = LowerBound(ComponentId);
+		if (Index < Entries.Num() && Entries[Index].Key == ComponentId)
 		{
-			Schema_Object* KVPairObject = Schema_IndexObject(ComponentObject, 2, i);
-			uint32 Key = Schema_GetUint32(KVPairObject, SCHEMA_MAP_KEY_FIELD_ID);
-			WorkerRequirementSet Value = GetWorkerRequirementSetFromSchema(KVPairObject, SCHEMA_MAP_VALUE_FIELD_ID);
-
-			ComponentWriteAcl.Add(Key, Value);
+			Entries[Index].Value = RequirementSet;
 		}
+		else
+		{
+			Entries.Insert(FEntry(ComponentId, RequirementSet), Index);
+		}
+	}
+
+	void Empty(int32 Slack = 0)
+	{
+		Entries.Empty(Slack);
+	}
+
+	int32 Num() const
+	{
+		return Entries.Num();
+	}
+
+	TArray<FEntry>::RangedForConstIteratorType begin() const { return Entries.begin(); }
+	TArray<FEntry>::RangedForConstIteratorType end() const { return Entries.end(); }
+
+private:
+	int32 LowerBound(Worker_ComponentId ComponentId) const
+	{
+		return Algo::LowerBoundBy(Entries, ComponentId, [](const FEntry& Entry) { return Entry.Key; });
+	}
+
+	TArray<FEntry> Entries;
+};
+
+struct EntityAcl : Component
+{
+	static const Worker_ComponentId ComponentId = SpatialConstants::ENTITY_ACL_COMPONENT_ID;
+
+	EntityAcl()
+		: ReadAcl(FWorkerRequirementSetPool::Intern(WorkerRequirementSet())) {}
+
+	EntityAcl(const WorkerRequirementSet& InReadAcl, const WriteAclMap& InComponentWriteAcl)
+		: ReadAcl(FWorkerRequirementSetPool::Intern(InReadAcl)), ComponentWriteAcl(InComponentWriteAcl) {}
+
+	EntityAcl(const Worker_ComponentData& Data)
+		: EntityAcl(Schema_GetComponentDataFields(Data.schema_type))
+	{
 	}
 
 	void ApplyComponentUpdate(const Worker_ComponentUpdate& Update)
@@ -99,22 +154,15 @@ struct EntityAcl : Component
 
 		if (Schema_GetObjectCount(ComponentObject, 1) > 0)
 		{
-			ReadAcl = GetWorkerRequirementSetFromSchema(ComponentObject, 1);
+			ReadAcl = FWorkerRequirementSetPool::InternFromSchema(ComponentObject, 1);
 		}
 
 		// This is never emptied, so does not need an additional check for cleared fields
 		uint32 KVPairCount = Schema_GetObjectCount(ComponentObject, 2);
 		if (KVPairCount > 0)
 		{
-			ComponentWriteAcl.Empty();
-			for (uint32 i = 0; i < KVPairCount; i++)
-			{
-				Schema_Object* KVPairObject = Schema_IndexObject(ComponentObject, 2, i);
-				uint32 Key = Schema_GetUint32(KVPairObject, SCHEMA_MAP_KEY_FIELD_ID);
-				WorkerRequirementSet Value = GetWorkerRequirementSetFromSchema(KVPairObject, SCHEMA_MAP_VALUE_FIELD_ID);
-
-				ComponentWriteAcl.Add(Key, Value);
-			}
+			ComponentWriteAcl.Empty(KVPairCount);
+			ReadComponentWriteAcl(ComponentObject, KVPairCount);
 		}
 	}
 
@@ -125,14 +173,7 @@ struct EntityAcl : Component
 		Data.schema_type = Schema_CreateComponentData(ComponentId);
 		Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data.schema_type);
 
-		AddWorkerRequirementSetToSchema(ComponentObject, 1, ReadAcl);
-
-		for (const auto& KVPair : ComponentWriteAcl)
-		{
-			Schema_Object* KVPairObject = Schema_AddObject(ComponentObject, 2);
-			Schema_AddUint32(KVPairObject, SCHEMA_MAP_KEY_FIELD_ID, KVPair.Key);
-			AddWorkerRequirementSetToSchema(KVPairObject, SCHEMA_MAP_VALUE_FIELD_ID, KVPair.Value);
-		}
+		WriteFields(ComponentObject);
 
 		return Data;
 	}
@@ -144,20 +185,45 @@ struct EntityAcl : Component
 		ComponentUpdate.schema_type = Schema_CreateComponentUpdate(ComponentId);
 		Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(ComponentUpdate.schema_type);
 
-		AddWorkerRequirementSetToSchema(ComponentObject, 1, ReadAcl);
+		WriteFields(ComponentObject);
+
+		return ComponentUpdate;
+	}
+
+	WorkerRequirementSetHandle ReadAcl;
+	SharedWriteAclMap ComponentWriteAcl;
+
+private:
+	EntityAcl(Schema_Object* ComponentObject)
+		: ReadAcl(FWorkerRequirementSetPool::InternFromSchema(ComponentObject, 1))
+	{
+		uint32 KVPairCount = Schema_GetObjectCount(ComponentObject, 2);
+		ComponentWriteAcl.Empty(KVPairCount);
+		ReadComponentWriteAcl(ComponentObject, KVPairCount);
+	}
+
+	void ReadComponentWriteAcl(Schema_Object* ComponentObject, uint32 KVPairCount)
+	{
+		for (uint32 i = 0; i < KVPairCount; i++)
+		{
+			Schema_Object* KVPairObject = Schema_IndexObject(ComponentObject, 2, i);
+			uint32 Key = Schema_GetUint32(KVPairObject, SCHEMA_MAP_KEY_FIELD_ID);
+
+			ComponentWriteAcl.Add(Key, FWorkerRequirementSetPool::InternFromSchema(KVPairObject, SCHEMA_MAP_VALUE_FIELD_ID));
+		}
+	}
+
+	void WriteFields(Schema_Object* ComponentObject) const
+	{
+		AddWorkerRequirementSetToSchema(ComponentObject, 1, *ReadAcl);
 
 		for (const auto& KVPair : ComponentWriteAcl)
 		{
 			Schema_Object* KVPairObject = Schema_AddObject(ComponentObject, 2);
 			Schema_AddUint32(KVPairObject, SCHEMA_MAP_KEY_FIELD_ID, KVPair.Key);
-			AddWorkerRequirementSetToSchema(KVPairObject, SCHEMA_MAP_VALUE_FIELD_ID, KVPair.Value);
+			AddWorkerRequirementSetToSchema(KVPairObject, SCHEMA_MAP_VALUE_FIELD_ID, *KVPair.Value);
 		}
-
-		return ComponentUpdate;
 	}
-
-	WorkerRequirementSet ReadAcl;
-	WriteAclMap ComponentWriteAcl;
 };
 
 struct Metadata : Component
@@ -25,8 +25,8 @@ struct UnrealMetadata : Component
 
 	UnrealMetadata() = default;
 
-	UnrealMetadata(const TSchemaOption<FUnrealObjectRef>& InStablyNamedRef, const FString& InOwnerWorkerAttribute, const FString& InClassPath, const TSchemaOption<bool>& InbNetStartup)
-		: StablyNamedRef(InStablyNamedRef), OwnerWorkerAttribute(InOwnerWorkerAttribute), ClassPath(InClassPath), bNetStartup(InbNetStartup) {}
+	UnrealMetadata(const TSchemaOption<FUnrealObjectRef>& InStablyNamedRef, const FString& InOwnerWorkerAttribute, const FString& InClassPath, const TSchemaOption<bool>& InbNetStartup, const TSchemaOption<uint32>& InClassId)
+		: StablyNamedRef(InStablyNamedRef), OwnerWorkerAttribute(InOwnerWorkerAttribute), ClassPath(InClassPath), bNetStartup(InbNetStartup), ClassId(InClassId) {}
 
 	UnrealMetadata(const Worker_ComponentData& Data)
 	{
@@ -43,6 +43,11 @@ struct UnrealMetadata : Component
 		{
 			bNetStartup = GetBoolFromSchema(ComponentObject, 4);
 		}
+
+		if (Schema_GetUint32Count(ComponentObject, 5) == 1)
+		{
+			ClassId = Schema_GetUint32(ComponentObject, 5);
+		}
 	}
 
 	Worker_ComponentData CreateUnrealMetadataData()
@@ -62,11 +67,15 @@ struct UnrealMetadata : Component
 		{
 			Schema_AddBool(ComponentObject, 4, bNetStartup.GetValue());
 		}
+		if (ClassId.IsSet())
+		{
+			Schema_AddUint32(ComponentObject, 5, ClassId.GetValue());
+		}
 
 		return Data;
 	}
 
-	FORCEINLINE UClass* GetNativeEntityClass()
+	FORCEINLINE UClass* GetNativeEntityClass(USpatialClassInfoManager* ClassInfoManager)
 	{
 		if (NativeClass.IsValid())
 		{
@@ -76,12 +85,16 @@ struct UnrealMetadata : Component
 #if !UE_BUILD_SHIPPING
 		if (NativeClass.IsStale())
 		{
-			UE_LOG(LogSpatialClassInfoManager, Warning, TEXT("UnrealMetadata native class %s unloaded whilst entity in view."), *ClassPath);
+			UE_LOG(LogSpatialClassInfoManager, Warning, TEXT("UnrealMetadata native class %s unloaded whilst entity in view."), *GetClassDescription());
 		}
 #endif
 		UClass* Class = nullptr;
 
-		if (StablyNamedRef.IsSet())
+		if (ClassId.IsSet())
+		{
+			Class = ClassInfoManager->GetActorClassByClassId(ClassId.GetValue(), /* bAllowLoad */ !StablyNamedRef.IsSet());
+		}
+		else if (StablyNamedRef.IsSet())
 		{
 			Class = FindObject<UClass>(nullptr, *ClassPath, false);
 		}
@@ -99,10 +112,18 @@ struct UnrealMetadata : Component
 		return nullptr;
 	}
 
+	// ClassPath is left empty for classes identified by ClassId, so use this when logging the class.
+	FString GetClassDescription() const
+	{
+		return ClassId.IsSet() ? FString::Printf(TEXT("[class id %u]"), ClassId.GetValue()) : ClassPath;
+	}
+
 	TSchemaOption<FUnrealObjectRef> StablyNamedRef;
 	FString OwnerWorkerAttribute;
 	FString ClassPath;
 	TSchemaOption<bool> bNetStartup;
+	// Persistent id of the Actor class in the schema database, used instead of ClassPath when set.
+	TSchemaOption<uint32> ClassId;
 
 	TWeakObjectPtr<UClass> NativeClass;
 };
@@ -9,6 +9,18 @@
 
 using Worker_EntityId = std::int64_t;
 
+struct FUnrealObjectRef;
+
+// Outer chains are shared between copies of a reference rather than copied level by level.
+namespace SpatialGDK
+{
+template <>
+struct TSchemaOptionUsesSharedStorage<FUnrealObjectRef>
+{
+	enum { Value = true };
+};
+} // namespace SpatialGDK
+
 struct FUnrealObjectRef
 {
 	FUnrealObjectRef() = default;
@@ -71,7 +83,7 @@ struct FUnrealObjectRef
 		return Entity == Other.Entity &&
 			Offset == Other.Offset &&
 			((!Path && !Other.Path) || (Path && Other.Path && Path->Equals(*Other.Path))) &&
-			((!Outer && !Other.Outer) || (Outer && Other.Outer && *Outer == *Other.Outer));
+			Outer == Other.Outer;
 		// Intentionally don't compare bNoLoadOnClient since it does not affect equality.
 	}
 
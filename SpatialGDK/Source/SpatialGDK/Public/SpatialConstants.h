@@ -115,6 +115,32 @@ namespace SpatialConstants
 	const Worker_ComponentId DEBUG_METRICS_COMPONENT_ID						= 9984;
 	const Worker_ComponentId ALWAYS_RELEVANT_COMPONENT_ID					= 9983;
 
+	// GDK components clients check out when their interest lists result components explicitly, see InterestFactory.
+	// New GDK components that clients need must be added here as well.
+	const TArray<Worker_ComponentId> ClientVisibleGDKComponentIds = {
+		ENTITY_ACL_COMPONENT_ID,
+		METADATA_COMPONENT_ID,
+		POSITION_COMPONENT_ID,
+		PERSISTENCE_COMPONENT_ID,
+		INTEREST_COMPONENT_ID,
+		SPAWN_DATA_COMPONENT_ID,
+		PLAYER_SPAWNER_COMPONENT_ID,
+		SINGLETON_COMPONENT_ID,
+		UNREAL_METADATA_COMPONENT_ID,
+		SINGLETON_MANAGER_COMPONENT_ID,
+		DEPLOYMENT_MAP_COMPONENT_ID,
+		STARTUP_ACTOR_MANAGER_COMPONENT_ID,
+		GSM_SHUTDOWN_COMPONENT_ID,
+		HEARTBEAT_COMPONENT_ID,
+		CLIENT_RPC_ENDPOINT_COMPONENT_ID,
+		SERVER_RPC_ENDPOINT_COMPONENT_ID,
+		NETMULTICAST_RPCS_COMPONENT_ID,
+		NOT_STREAMED_COMPONENT_ID,
+		RPCS_ON_ENTITY_CREATION_ID,
+		DEBUG_METRICS_COMPONENT_ID,
+		ALWAYS_RELEVANT_COMPONENT_ID
+	};
+
 	const Worker_ComponentId STARTING_GENERATED_COMPONENT_ID				= 10000;
 
 	const Schema_FieldId SINGLETON_MANAGER_SINGLETON_NAME_TO_ENTITY_ID		= 1;
@@ -151,11 +177,19 @@ namespace SpatialConstants
 	// UnrealPackedRPCPayload additional Field ID
 	const Schema_FieldId UNREAL_PACKED_RPC_PAYLOAD_ENTITY_ID				= 4;
 
+	// UnrealRPCBatch Field IDs
+	const Schema_FieldId UNREAL_RPC_BATCH_RPCS_ID							= 1;
+
 	// Unreal(Client|Server|Multicast)RPCEndpoint Field IDs
 	const Schema_FieldId UNREAL_RPC_ENDPOINT_READY_ID 						= 1;
+	const Schema_FieldId UNREAL_CLIENT_RPC_ENDPOINT_ACKED_RPCS_ON_ENTITY_CREATION_ID = 2;
 	const Schema_FieldId UNREAL_RPC_ENDPOINT_EVENT_ID						= 1;
 	const Schema_FieldId UNREAL_RPC_ENDPOINT_PACKED_EVENT_ID				= 2;
+	const Schema_FieldId UNREAL_RPC_ENDPOINT_BATCH_EVENT_ID					= 3;
+	const Schema_FieldId UNREAL_RPC_ENDPOINT_PACKED_BATCH_EVENT_ID			= 4;
+	const Schema_FieldId UNREAL_MULTICAST_RPC_ENDPOINT_BATCH_EVENT_ID		= 2;
 	const Schema_FieldId UNREAL_RPC_ENDPOINT_COMMAND_ID						= 1;
+	const Schema_FieldId UNREAL_RPC_ENDPOINT_BATCH_COMMAND_ID				= 2;
 
 	const Schema_FieldId PLAYER_SPAWNER_SPAWN_PLAYER_COMMAND_ID = 1;
 
@@ -197,6 +231,14 @@ namespace SpatialConstants
 	const Worker_ComponentId MAX_EXTERNAL_SCHEMA_ID = 2000;
 
 	const FString SPATIALOS_METRICS_DYNAMIC_FPS = TEXT("Dynamic.FPS");
+	const FString SPATIALOS_METRICS_OP_PROCESSING_LOAD = TEXT("Load.OpProcessing");
+	const FString SPATIALOS_METRICS_REPLICATION_LOAD = TEXT("Load.Replication");
+	const FString SPATIALOS_METRICS_RPC_LOAD = TEXT("Load.RPC");
+	const FString SPATIALOS_METRICS_INTEREST_LOAD = TEXT("Load.Interest");
+	const FString SPATIALOS_METRICS_OP_LIST_QUEUE_DEPTH = TEXT("Ops.QueueDepth");
+	const FString SPATIALOS_METRICS_OP_LIST_MAX_DWELL_TIME = TEXT("Ops.MaxDwellTime");
+	const FString SPATIALOS_METRICS_OP_LIST_AVERAGE_DWELL_TIME = TEXT("Ops.AverageDwellTime");
+	const FString SPATIALOS_METRICS_OP_LIST_QUEUE_FULL_COUNT = TEXT("Ops.QueueFullCount");
 
 	const FString LOCATOR_HOST = TEXT("locator.improbable.io");
 	const uint16 LOCATOR_PORT = 444;
@@ -6,6 +6,7 @@
 #include "Engine/EngineTypes.h"
 #include "Misc/Paths.h"
 #include "Utils/ActorGroupManager.h"
+#include "Utils/PositionUpdatePolicy.h"
 
 #include "SpatialGDKSettings.generated.h"
 
@@ -23,6 +24,15 @@ public:
 	
 	virtual void PostInitProperties() override;
 
+	// Returns the position update policy of this class or its closest parent, or the default policy if none is configured.
+	FPositionUpdatePolicy GetPositionUpdatePolicyForClass(const UClass* Class) const;
+
+	// Returns the shortest MinUpdateInterval across all position update policies.
+	float GetMinPositionUpdateInterval() const;
+
+	// Returns the client Actor pool size of this class or its closest parent, or 0 if it isn't pooled.
+	uint32 GetClientActorPoolSizeForClass(const UClass* Class) const;
+
 	/** 
 	 * The number of entity IDs to be reserved when the entity pool is first created. Ensure that the number of entity IDs
 	 * reserved is greater than the number of Actors that you expect the server-worker instances to spawn at game deployment 
@@ -43,7 +53,10 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Entity Pool", meta = (ConfigRestartRequired = false, DisplayName = "Refresh Count"))
 	uint32 EntityPoolRefreshCount;
 
-	/** Specifies the amount of time, in seconds, between heartbeat events sent from a game client to notify the server-worker instances that it's connected. */
+	/**
+	* Specifies the amount of time, in seconds, between heartbeat events sent from a game client to notify the server-worker instances that it's connected.
+	* RPCs the client sends through its PlayerController count as heartbeats, so heartbeat events are only sent when the client has been idle for this long.
+	*/
 	UPROPERTY(EditAnywhere, config, Category = "Heartbeat", meta = (ConfigRestartRequired = false, DisplayName = "Heartbeat Interval (seconds)"))
 	float HeartbeatIntervalSeconds;
 
@@ -87,6 +100,59 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false))
 	float MaxNetCullDistanceSquared;
 
+	/**
+	 * NetCullDistanceSquared used by clients for each property group, declared with meta = (SpatialPropertyGroup = "GroupName") on replicated properties.
+	 * Properties in a group are only received by clients within this distance of the Actor, while the rest of the Actor uses its own NetCullDistanceSquared.
+	 * Groups without an entry use DefaultPropertyGroupNetCullDistanceSquared. Requires Query Based Interest and bEnableClientPropertyGroupInterest.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false))
+	TMap<FName, float> PropertyGroupNetCullDistanceSquared;
+
+	/** NetCullDistanceSquared used for property groups that don't have an entry in PropertyGroupNetCullDistanceSquared.*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false))
+	float DefaultPropertyGroupNetCullDistanceSquared;
+
+	/**
+	 * Check out property groups on clients by their own NetCullDistanceSquared. When disabled, clients check out full entities and property groups
+	 * use the Actor's NetCullDistanceSquared. When enabled, clients check out an explicit list of components instead: GDK components, generated
+	 * components, external schema components and AdditionalClientResultComponentIds. Components of any other schema must be added there.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false))
+	bool bEnableClientPropertyGroupInterest;
+
+	/** Component ids of user schema that clients check out in addition to the GDK and generated components, see bEnableClientPropertyGroupInterest.*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, EditCondition = "bEnableClientPropertyGroupInterest"))
+	TArray<uint32> AdditionalClientResultComponentIds;
+
+	/**
+	 * Maximum number of components listed in the client query that leaves out property groups. Projects with more components than this
+	 * check out full entities instead, as if bEnableClientPropertyGroupInterest was disabled.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, EditCondition = "bEnableClientPropertyGroupInterest"))
+	uint32 MaxClientResultComponentIds;
+
+	/**
+	 * Maximum number of Actors kept per class on clients to be reused for new entities, instead of destroying Actors when their entity leaves view
+	 * and spawning new ones. Intended for short-lived entities such as projectiles. Children of these classes are pooled too.
+	 * Pooled Actors go through EndPlay when released and BeginPlay when reused, but are not destroyed, so they must not rely on their constructor for per-entity state.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false))
+	TMap<TSoftClassPtr<AActor>, uint32> ClientActorPoolSizes;
+
+	/**
+	 * Number of op lists received from SpatialOS that can wait to be processed by the game thread. Rounded up to fit the underlying circular buffer.
+	 * Reaching it means the game thread isn't keeping up with the incoming ops.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = true, ClampMin = "2", DisplayName = "Op list queue capacity"))
+	uint32 OpListQueueCapacity;
+
+	/**
+	 * When the op list queue is full, stop taking ops from the worker SDK, which keeps them until there is space again.
+	 * Disable to keep taking them and hold on to the op lists that don't fit until there is space, which doesn't bound their number.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = true))
+	bool bLeaveOpsInSDKWhenOpListQueueFull;
+
 	/** Seconds to wait before executing a received RPC substituting nullptr for unresolved UObjects*/
 	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, DisplayName = "Wait Time Before Processing Received RPC With Unresolved Refs"))
 	float QueuedIncomingRPCWaitTime;
@@ -103,6 +169,10 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "SpatialOS Position Updates", meta = (ConfigRestartRequired = false))
 	float PositionDistanceThreshold;
 
+	/** Per class overrides of when an Actor's SpatialOS Position is updated. Children of these classes will also use the policy. Other Actors use PositionDistanceThreshold and PositionUpdateFrequency. */
+	UPROPERTY(EditAnywhere, config, Category = "SpatialOS Position Updates", meta = (ConfigRestartRequired = false))
+	TMap<TSoftClassPtr<AActor>, FPositionUpdatePolicy> PositionUpdatePolicies;
+
 	/** Metrics about client and server performance can be reported to SpatialOS to monitor a deployments health.*/
 	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (ConfigRestartRequired = false))
 	bool bEnableMetrics;
@@ -123,6 +193,22 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (ConfigRestartRequired = false))
 	bool bUseFrameTimeAsLoad;
 
+	/**
+	 * Report load as the average time the game thread was busy per frame relative to the target frame time (1 / NetServerMaxTickRate), excluding
+	 * the time spent waiting for the next tick when the tick rate is capped. Unlike the frame time, this tells an idle worker apart from a saturated one,
+	 * and exceeds 1 when the worker can't keep up with its tick rate. Ignored if bUseFrameTimeAsLoad is set.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (ConfigRestartRequired = false))
+	bool bUseBusyTimeAsLoad;
+
+	/** Number of metrics reports the busy time load is averaged over.*/
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (ConfigRestartRequired = false, ClampMin = "1"))
+	int32 LoadSmoothingReportCount;
+
+	/** Also report the fraction of time spent in op processing, replication, RPCs and interest as gauge metrics.*/
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (ConfigRestartRequired = false))
+	bool bReportSubsystemLoad;
+
 	/** Include an order index with reliable RPCs and warn if they are executed out of order.*/
 	UPROPERTY(config, meta = (ConfigRestartRequired = false))
 	bool bCheckRPCOrder;
@@ -144,6 +230,44 @@ public:
 	UPROPERTY(config, meta = (ConfigRestartRequired = false))
 	bool bPackRPCs;
 
+	/** Send RPCs sent to the same endpoint during the same frame as a single compact event. All workers must use the same version of the GDK. */
+	UPROPERTY(config, meta = (ConfigRestartRequired = false))
+	bool bBatchRPCEvents;
+
+	/**
+	 * Send CrossServer RPCs to the same entity during the same frame as a single command. Reliable RPCs of a batch that fails are retried individually.
+	 * All workers must use the same version of the GDK.
+	 */
+	UPROPERTY(config, meta = (ConfigRestartRequired = false))
+	bool bBatchCrossServerRPCs;
+
+	/** Serialize RPC parameters with a codec compiled once per function, which copies plain old data parameters as a single block. All workers must use the same value. */
+	UPROPERTY(config, meta = (ConfigRestartRequired = false))
+	bool bUseRPCParameterCodecs;
+
+	/**
+	 * Maximum number of RPCs an Actor can queue before its entity is created. When the queue is full, unreliable RPCs are dropped
+	 * and reliable RPCs replace the oldest queued unreliable RPC, or are dropped with a warning if there is none.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, ClampMin = "1", DisplayName = "Maximum RPCs queued on entity creation"))
+	uint32 MaxRPCsOnEntityCreation;
+
+	/** Parse the initial component data of entities received in a critical section on worker threads, before their Actors are spawned. */
+	UPROPERTY(config, meta = (ConfigRestartRequired = false))
+	bool bParseComponentDataInParallel;
+
+	/** Store identical component data of entities in a snapshot only once while loading it, and copy it into each entity's create request when spawning. */
+	UPROPERTY(config, meta = (ConfigRestartRequired = false))
+	bool bDeduplicateSnapshotComponents;
+
+	/**
+	 * Load the classes of received entities, and the packages of stably named objects they reference, asynchronously.
+	 * Entities wait to be spawned until their class has loaded, and references stay unresolved until their package has loaded.
+	 * Entities are only held back on clients, servers still load their classes synchronously. Disable to load them synchronously on the game thread when they are received.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Async Loading", meta = (ConfigRestartRequired = false))
+	bool bAsyncLoadNewClassesOnEntityCheckout;
+
 	/** The receptionist host to use if no 'receptionistHost' argument is passed to the command line. */
 	UPROPERTY(EditAnywhere, config, Category = "Local Connection", meta = (ConfigRestartRequired = false))
 	FString DefaultReceptionistHost;
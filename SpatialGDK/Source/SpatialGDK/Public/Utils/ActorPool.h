@@ -0,0 +1,34 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSpatialActorPool, Log, All);
+
+// Keeps the Actors of short-lived entities around after they leave a client's view, so the next entity of the same class
+// can reuse one instead of spawning a new Actor. Only classes configured in USpatialGDKSettings::ClientActorPoolSizes are pooled.
+// Released Actors go through EndPlay and are hidden and deactivated. Acquired Actors have their replicated properties reset to
+// the class defaults, go through component initialization again and are expected to go through BeginPlay, the same as a newly spawned Actor.
+class SPATIALGDK_API FActorPool
+{
+public:
+	// Returns true if the Actor's class is pooled and its pool has room for another Actor.
+	bool CanRelease(const AActor* Actor);
+
+	void Release(AActor* Actor);
+	AActor* Acquire(UClass* Class, const FTransform& Transform);
+
+private:
+	struct FClassPool
+	{
+		uint32 MaxSize = 0;
+		TArray<TWeakObjectPtr<AActor>> Actors;
+	};
+
+	FClassPool& GetClassPool(const UClass* Class);
+
+	TMap<TWeakObjectPtr<const UClass>, FClassPool> ClassPools;
+};
@@ -5,6 +5,7 @@
 #include "Interop/SpatialClassInfoManager.h"
 #include "Schema/Interest.h"
 #include "Utils/RepDataUtils.h"
+#include "Utils/UnresolvedObjectsTracker.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
 #include <WorkerSDK/improbable/c_worker.h>
@@ -19,7 +20,6 @@ class UProperty;
 
 enum EReplicatedPropertyGroup : uint32;
 
-using FUnresolvedObjectsSet = TSet<TWeakObjectPtr<const UObject>>;
 using FUnresolvedObjectsMap = TMap<Schema_FieldId, FUnresolvedObjectsSet>;
 
 namespace SpatialGDK
@@ -38,10 +38,11 @@ public:
 	static Worker_ComponentData CreateEmptyComponentData(Worker_ComponentId ComponentId);
 
 private:
-	Worker_ComponentData CreateComponentData(Worker_ComponentId ComponentId, UObject* Object, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup);
-	Worker_ComponentUpdate CreateComponentUpdate(Worker_ComponentId ComponentId, UObject* Object, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, bool& bWroteSomething);
+	Worker_ComponentData CreateComponentData(Worker_ComponentId ComponentId, UObject* Object, const FClassInfo& Info, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup);
+	Worker_ComponentUpdate CreateComponentUpdate(Worker_ComponentId ComponentId, UObject* Object, const FClassInfo& Info, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, bool& bWroteSomething);
 
-	bool FillSchemaObject(Schema_Object* ComponentObject, UObject* Object, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, bool bIsInitialData, TArray<Schema_FieldId>* ClearedIds = nullptr);
+	// PropertyGroupComponent selects the properties of a user-defined property group, or those outside of any group if INVALID_COMPONENT_ID.
+	bool FillSchemaObject(Schema_Object* ComponentObject, UObject* Object, const FClassInfo& Info, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, Worker_ComponentId PropertyGroupComponent, bool bIsInitialData, TArray<Schema_FieldId>* ClearedIds = nullptr);
 
 	Worker_ComponentUpdate CreateHandoverComponentUpdate(Worker_ComponentId ComponentId, UObject* Object, const FClassInfo& Info, const FHandoverChangeState& Changes, bool& bWroteSomething);
 
@@ -61,6 +62,9 @@ private:
 	FUnresolvedObjectsMap& PendingRepUnresolvedObjectsMap;
 	FUnresolvedObjectsMap& PendingHandoverUnresolvedObjectsMap;
 
+	// Scratch set reused for every handle, so that the common case of no unresolved objects does not allocate.
+	FUnresolvedObjectsSet UnresolvedObjectsScratch;
+
 	bool bInterestHasChanged;
 };
 
@@ -0,0 +1,57 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Schema/UnrealObjectRef.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+#include <WorkerSDK/improbable/c_worker.h>
+
+class FRepLayout;
+struct FClassInfo;
+
+namespace SpatialGDK
+{
+
+// Values of a single schema field, read without touching the object they will be applied to.
+// Only the array matching the property type is filled, arrays have one entry per element.
+struct ParsedSchemaField
+{
+	int32 Num() const
+	{
+		return Integers.Num() + Reals.Num() + Strings.Num() + Bytes.Num() + ObjectRefs.Num();
+	}
+
+	Schema_FieldId FieldId = 0;
+
+	// Bools, integers and enums. Unsigned values are stored bitwise.
+	TArray<int64> Integers;
+	TArray<double> Reals;
+	TArray<FString> Strings;
+	// Serialized structs and fast array payloads.
+	TArray<TArray<uint8>> Bytes;
+	TArray<FUnrealObjectRef> ObjectRefs;
+};
+
+struct ParsedComponentData
+{
+	// The class whose layout the fields were parsed with.
+	const UClass* Class = nullptr;
+	TArray<ParsedSchemaField> Fields;
+
+	// Keeps the allocation of Fields, so the same data can be parsed into repeatedly.
+	void Reset()
+	{
+		Class = nullptr;
+		Fields.Reset();
+	}
+};
+
+// Parsing only depends on the class layout, not on any Actor state, so these can run off the game thread
+// as long as the rep layout and class info have been created on the game thread beforehand.
+SPATIALGDK_API void ParseSchemaObject(Schema_Object* ComponentObject, const TArray<Schema_FieldId>& FieldIds, const FRepLayout& RepLayout, ParsedComponentData& OutParsedData);
+SPATIALGDK_API void ParseHandoverSchemaObject(Schema_Object* ComponentObject, const TArray<Schema_FieldId>& FieldIds, const FClassInfo& ClassInfo, ParsedComponentData& OutParsedData);
+
+} // namespace SpatialGDK
@@ -4,6 +4,7 @@
 
 #include "EngineClasses/SpatialNetBitReader.h"
 #include "Interop/SpatialReceiver.h"
+#include "Utils/ComponentParser.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatialComponentReader, All, All);
 
@@ -16,16 +17,21 @@ public:
 	ComponentReader(class USpatialNetDriver* InNetDriver, FObjectReferencesMap& InObjectReferencesMap, TSet<FUnrealObjectRef>& InUnresolvedRefs);
 
 	void ApplyComponentData(const Worker_ComponentData& ComponentData, UObject* Object, USpatialActorChannel* Channel, bool bIsHandover);
-	void ApplyComponentUpdate(const Worker_ComponentUpdate& ComponentUpdate, UObject* Object, USpatialActorChannel* Channel, bool bIsHandover);
+	// ScratchParsedData is reset and parsed into, so callers can keep it between updates to avoid allocating for each one.
+	void ApplyComponentUpdate(const Worker_ComponentUpdate& ComponentUpdate, UObject* Object, USpatialActorChannel* Channel, bool bIsHandover, ParsedComponentData& ScratchParsedData);
+
+	// Applies initial component data that has already been parsed, see ParseSchemaObject.
+	void ApplyParsedComponentData(ParsedComponentData& ParsedData, UObject* Object, USpatialActorChannel* Channel, bool bIsHandover);
 
 private:
-	void ApplySchemaObject(Schema_Object* ComponentObject, UObject* Object, USpatialActorChannel* Channel, bool bIsInitialData, TArray<Schema_FieldId>& UpdatedIds);
-	void ApplyHandoverSchemaObject(Schema_Object* ComponentObject, UObject* Object, USpatialActorChannel* Channel, bool bIsInitialData, TArray<Schema_FieldId>& UpdatedIds);
+	void ParseComponentObject(Schema_Object* ComponentObject, UObject* Object, bool bIsHandover, const TArray<Schema_FieldId>& UpdatedIds, ParsedComponentData& OutParsedData);
+	void ApplyParsedData(ParsedComponentData& ParsedData, UObject* Object, USpatialActorChannel* Channel, bool bIsHandover, bool bIsInitialData);
 
-	void ApplyProperty(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, uint32 Index, UProperty* Property, uint8* Data, int32 Offset, int32 CmdIndex, int32 ParentIndex);
-	void ApplyArray(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, UArrayProperty* Property, uint8* Data, int32 Offset, int32 CmdIndex, int32 ParentIndex);
+	void ApplySchemaObject(ParsedComponentData& ParsedData, UObject* Object, USpatialActorChannel* Channel, bool bIsInitialData);
+	void ApplyHandoverSchemaObject(ParsedComponentData& ParsedData, UObject* Object, USpatialActorChannel* Channel);
 
-	uint32 GetPropertyCount(const Schema_Object* Object, Schema_FieldId Id, UProperty* Property);
+	void ApplyProperty(ParsedSchemaField& Field, FObjectReferencesMap& InObjectReferencesMap, uint32 Index, UProperty* Property, uint8* Data, int32 Offset, int32 ShadowOffset, int32 ParentIndex);
+	void ApplyArray(ParsedSchemaField& Field, FObjectReferencesMap& InObjectReferencesMap, UArrayProperty* Property, uint8* Data, int32 Offset, int32 ShadowOffset, int32 ParentIndex);
 
 private:
 	class USpatialPackageMapClient* PackageMap;
@@ -0,0 +1,38 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/List.h"
+
+#include "SpatialCommonTypes.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+// Tracks the last time each client's PlayerController entity showed a sign of life, ordered from least to most recent.
+// A heartbeat moves an entity to the back of the order, so finding timed out clients only has to look at the front
+// instead of keeping a timer per client.
+class SPATIALGDK_API FHeartbeatTracker
+{
+public:
+	void Add(Worker_EntityId EntityId, double Time);
+	void Remove(Worker_EntityId EntityId);
+
+	// Does nothing for entities that are not tracked.
+	void OnHeartbeat(Worker_EntityId EntityId, double Time);
+
+	// Stops tracking and returns the entities whose last heartbeat was before Deadline.
+	void RemoveTimedOut(double Deadline, TArray<Worker_EntityId>& OutTimedOut);
+
+private:
+	struct FEntry
+	{
+		Worker_EntityId EntityId;
+		double LastHeartbeatTime;
+	};
+
+	using FSweepOrder = TDoubleLinkedList<FEntry>;
+
+	FSweepOrder SweepOrder;
+	TMap<Worker_EntityId_Key, FSweepOrder::TDoubleLinkedListNode*> Nodes;
+};
@@ -10,6 +10,7 @@
 class USpatialNetDriver;
 class USpatialPackageMapClient;
 class AActor;
+class UActorInterestComponent;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogInterestFactory, Log, All);
 
@@ -17,6 +18,8 @@ namespace SpatialGDK
 {
 
 void GatherClientInterestDistances();
+// Called when an Actor class gets its class info, so cached interest that depends on the loaded classes includes it.
+void OnActorClassRegistered(UClass* Class);
 
 class SPATIALGDK_API InterestFactory
 {
@@ -29,6 +32,9 @@ public:
 private:
 	Interest CreateInterest() const;
 
+	// Returns the cached interest shared by all actors without custom interest, or nullptr if this actor can't use it.
+	Interest* GetSharedActorInterest() const;
+
 	// Only uses Defined Constraint
 	Interest CreateActorInterest() const;
 	// Defined Constraint AND Level Constraint
@@ -36,10 +42,18 @@ private:
 
 	void AddUserDefinedQueries(const QueryConstraint& LevelConstraints, TArray<SpatialGDK::Query>& OutQueries) const;
 
+	// Used instead of a full snapshot result for clients when property groups are in use, so that group components
+	// are only checked out through the per group queries. Empty if the list would exceed MaxClientResultComponentIds.
+	TArray<uint32> CreateClientResultComponentIds() const;
+	void AddPropertyGroupQueries(const QueryConstraint& LevelConstraints, TArray<SpatialGDK::Query>& OutQueries) const;
+
+	// Whether the actor has AlwaysInterested properties or an ActorInterestComponent.
+	bool HasCustomInterest() const;
+
 	// Checkout Constraint OR AlwaysInterested Constraint
 	QueryConstraint CreateSystemDefinedConstraints() const;
 
-	// System Defined Constraints
+	// System Defined Constraints. Checkout radius and always relevant constraints are shared by all actors and cached.
 	QueryConstraint CreateCheckoutRadiusConstraints() const;
 	QueryConstraint CreateAlwaysInterestedConstraint() const;
 	QueryConstraint CreateAlwaysRelevantConstraint() const;
@@ -54,6 +68,7 @@ private:
 	const FClassInfo& Info;
 	USpatialNetDriver* NetDriver;
 	USpatialPackageMapClient* PackageMap;
+	UActorInterestComponent* ActorInterestComponent;
 };
 
 } // namespace SpatialGDK
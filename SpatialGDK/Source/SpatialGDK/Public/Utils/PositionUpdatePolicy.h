@@ -0,0 +1,76 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "PositionUpdatePolicy.generated.h"
+
+// Describes when an Actor's SpatialOS Position should be updated.
+// The distance an Actor needs to move grows with its speed and with its distance to the nearest viewer,
+// and updates are rate limited to a minimum interval while a maximum interval bounds how stale a moving Actor can get.
+USTRUCT()
+struct FPositionUpdatePolicy
+{
+	GENERATED_BODY()
+
+	/** Threshold an Actor needs to move, in centimeters, before its SpatialOS Position is updated. */
+	UPROPERTY(EditAnywhere, Category = "SpatialGDK", meta = (ClampMin = "0.0"))
+	float DistanceThreshold;
+
+	/** Centimeters added to the threshold per cm/s the Actor moved at since its last update. */
+	UPROPERTY(EditAnywhere, Category = "SpatialGDK", meta = (ClampMin = "0.0"))
+	float SpeedThresholdScale;
+
+	/** Centimeters added to the threshold per centimeter between the Actor and the nearest viewer this server tracks. */
+	UPROPERTY(EditAnywhere, Category = "SpatialGDK", meta = (ClampMin = "0.0"))
+	float ViewerDistanceThresholdScale;
+
+	/** Upper bound for the threshold after speed and viewer distance are taken into account. Set to 0.0 to disable. */
+	UPROPERTY(EditAnywhere, Category = "SpatialGDK", meta = (ClampMin = "0.0"))
+	float MaxDistanceThreshold;
+
+	/** Minimum time, in seconds, between two SpatialOS Position updates. */
+	UPROPERTY(EditAnywhere, Category = "SpatialGDK", meta = (ClampMin = "0.0"))
+	float MinUpdateInterval;
+
+	/** Time, in seconds, after which any movement is sent regardless of the threshold. Set to 0.0 to disable. */
+	UPROPERTY(EditAnywhere, Category = "SpatialGDK", meta = (ClampMin = "0.0"))
+	float MaxUpdateInterval;
+
+	FPositionUpdatePolicy()
+		: DistanceThreshold(100.0f) // 1m (100cm)
+		, SpeedThresholdScale(0.0f)
+		, ViewerDistanceThresholdScale(0.0f)
+		, MaxDistanceThreshold(0.0f)
+		, MinUpdateInterval(1.0f)
+		, MaxUpdateInterval(0.0f)
+	{
+	}
+
+	float GetDistanceThreshold(float Speed, float ViewerDistance) const
+	{
+		float Threshold = DistanceThreshold + Speed * SpeedThresholdScale + ViewerDistance * ViewerDistanceThresholdScale;
+		if (MaxDistanceThreshold > 0.0f)
+		{
+			Threshold = FMath::Min(Threshold, MaxDistanceThreshold);
+		}
+		return Threshold;
+	}
+
+	bool ShouldSendUpdate(float DistanceMoved, float TimeSinceLastUpdate, float ViewerDistance) const
+	{
+		if (TimeSinceLastUpdate < MinUpdateInterval)
+		{
+			return false;
+		}
+
+		if (MaxUpdateInterval > 0.0f && TimeSinceLastUpdate >= MaxUpdateInterval && DistanceMoved > KINDA_SMALL_NUMBER)
+		{
+			return true;
+		}
+
+		const float Speed = TimeSinceLastUpdate > 0.0f ? DistanceMoved / TimeSinceLastUpdate : 0.0f;
+		return DistanceMoved >= GetDistanceThreshold(Speed, ViewerDistance);
+	}
+};
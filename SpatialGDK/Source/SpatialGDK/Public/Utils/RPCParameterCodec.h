@@ -0,0 +1,52 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Net/RepLayout.h"
+
+class FNetBitReader;
+class FNetBitWriter;
+class UBoolProperty;
+
+// Serializes the parameters of an RPC using a flat list of operations compiled once from the function's FRepLayout.
+// Plain old data parameters (numbers, enums, bools, vectors and rotators, including the ones inside structs that don't
+// have a native NetSerialize) are copied as a single byte-aligned block at the start of the payload. All other
+// parameters follow, serialized through the same RepLayout path as RepLayout_SendPropertiesForRPC.
+// The format is not compatible with RepLayout_(Send|Receive)PropertiesForRPC, so all workers must agree on using it.
+class SPATIALGDK_API FRPCParameterCodec
+{
+public:
+	FRPCParameterCodec(const TSharedPtr<FRepLayout>& InRepLayout);
+
+	void Write(FNetBitWriter& Writer, void* Parameters) const;
+	void Read(FNetBitReader& Reader, void* Parameters) const;
+
+	// True if every parameter is written as part of the byte-aligned block.
+	bool IsPlainOldData() const { return GenericOps.Num() == 0; }
+
+private:
+	struct FBlockOp
+	{
+		int32 Offset;
+		int32 Size;
+		// Set for bools, which are written as a single 0 or 1 byte and normalized on read.
+		UBoolProperty* BoolProperty;
+	};
+
+	struct FGenericOp
+	{
+		int32 CmdStart;
+		int32 CmdEnd;
+	};
+
+	TSharedPtr<FRepLayout> RepLayout;
+
+	TArray<FBlockOp> BlockOps;
+	int32 BlockSize = 0;
+
+	TArray<FGenericOp> GenericOps;
+
+	// Parameters that need to be constructed before being read into.
+	TArray<UProperty*> PropertiesToInitialize;
+};
@@ -24,6 +24,23 @@ struct FActorSpecificSubobjectSchemaData
 	uint32 SchemaComponents[SCHEMA_Count] = {};
 };
 
+// Schema data related to a user-defined property group of an Actor class, see the SpatialPropertyGroup metadata.
+USTRUCT()
+struct FPropertyGroupSchemaData
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	FName Name;
+
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	uint32 ComponentId = 0;
+
+	// Rep handles of the properties replicated in this group's component instead of the data component.
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	TArray<uint32> Handles;
+};
+
 // Schema data related to an Actor class
 USTRUCT()
 struct FActorSchemaData
@@ -36,6 +53,9 @@ struct FActorSchemaData
 	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
 	uint32 SchemaComponents[SCHEMA_Count] = {};
 
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	TArray<FPropertyGroupSchemaData> PropertyGroups;
+
 	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
 	TMap<uint32, FActorSpecificSubobjectSchemaData> SubobjectData;
 };
@@ -79,7 +99,7 @@ class SPATIALGDK_API USchemaDatabase : public UDataAsset
 
 public:
 
-	USchemaDatabase() : NextAvailableComponentId(SpatialConstants::STARTING_GENERATED_COMPONENT_ID) {}
+	USchemaDatabase() : NextAvailableComponentId(SpatialConstants::STARTING_GENERATED_COMPONENT_ID), NextAvailableClassId(1) {}
 
 	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
 	TMap<FString, FActorSchemaData> ActorClassPathToSchema;
@@ -98,5 +118,13 @@ public:
 
 	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
 	uint32 NextAvailableComponentId;
+
+	// Ids identifying Actor classes in UnrealMetadata instead of their class path. Entries are kept when classes are removed and
+	// when generated schema is cleared, so an id always refers to the same class, including for entities in older snapshots.
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	TMap<FString, uint32> ActorClassPathToClassId;
+
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	uint32 NextAvailableClassId;
 };
 
@@ -1,52 +1,203 @@
 #pragma once
 
-#include "Templates/UniquePtr.h"
+#include "Containers/UnrealString.h"
+#include "Templates/ChooseClass.h"
+#include "Templates/SharedPointer.h"
+#include "Templates/TypeCompatibleBytes.h"
 
 namespace SpatialGDK
 {
 
+// Values are stored inline by default. A type that contains an option of itself (e.g. an object ref and its outer)
+// can't be, so it should specialize this to use shared storage instead: copies then share the same value, and it is
+// only copied when written through an option that shares it. Copying a chain of such values doesn't allocate.
 template <typename T>
-class TSchemaOption
+struct TSchemaOptionUsesSharedStorage
+{
+	enum { Value = false };
+};
+
+// Copying an FString allocates anyway, so sharing it is never worse.
+template <>
+struct TSchemaOptionUsesSharedStorage<FString>
+{
+	enum { Value = true };
+};
+
+namespace SchemaOptionPrivate
+{
+
+template <typename T>
+class TInlineStorage
 {
 public:
-	TSchemaOption() = default;
-	~TSchemaOption() = default;
+	TInlineStorage() = default;
 
-	TSchemaOption(const T& InValue)
-		: Value(MakeUnique<T>(InValue))
-	{}
+	TInlineStorage(const TInlineStorage& Other)
+	{
+		if (Other.bIsSet)
+		{
+			Emplace(*Other.Get());
+		}
+	}
 
-	TSchemaOption(T&& InValue)
-		: Value(MakeUnique<T>(MoveTemp(InValue)))
-	{}
+	TInlineStorage(TInlineStorage&& Other)
+	{
+		if (Other.bIsSet)
+		{
+			Emplace(MoveTemp(*Other.GetMutable()));
+			Other.Reset();
+		}
+	}
 
-	TSchemaOption(const TSchemaOption& InValue)
+	~TInlineStorage()
 	{
-		*this = InValue;
+		Reset();
 	}
 
-	TSchemaOption(TSchemaOption&&) = default;
+	TInlineStorage& operator=(const TInlineStorage& Other)
+	{
+		if (this != &Other)
+		{
+			if (Other.bIsSet)
+			{
+				Emplace(*Other.Get());
+			}
+			else
+			{
+				Reset();
+			}
+		}
+
+		return *this;
+	}
 
-	TSchemaOption& operator=(const TSchemaOption& InValue)
+	TInlineStorage& operator=(TInlineStorage&& Other)
 	{
-		if (this != &InValue)
+		if (this != &Other)
 		{
-			if (InValue)
+			if (Other.bIsSet)
 			{
-				Value = MakeUnique<T>(*InValue);
+				Emplace(MoveTemp(*Other.GetMutable()));
+				Other.Reset();
+			}
+			else
+			{
+				Reset();
 			}
 		}
 
 		return *this;
 	}
 
-	TSchemaOption& operator=(TSchemaOption&&) = default;
+	template <typename... ArgTypes>
+	void Emplace(ArgTypes&&... Args)
+	{
+		Reset();
+		new (&Value) T(Forward<ArgTypes>(Args)...);
+		bIsSet = true;
+	}
+
+	void Reset()
+	{
+		if (bIsSet)
+		{
+			GetMutable()->~T();
+			bIsSet = false;
+		}
+	}
+
+	FORCEINLINE bool IsSet() const
+	{
+		return bIsSet;
+	}
+
+	FORCEINLINE const T* Get() const
+	{
+		return bIsSet ? reinterpret_cast<const T*>(&Value) : nullptr;
+	}
+
+	FORCEINLINE T* GetMutable()
+	{
+		return bIsSet ? reinterpret_cast<T*>(&Value) : nullptr;
+	}
+
+private:
+	TTypeCompatibleBytes<T> Value;
+	bool bIsSet = false;
+};
+
+template <typename T>
+class TSharedStorage
+{
+public:
+	template <typename... ArgTypes>
+	void Emplace(ArgTypes&&... Args)
+	{
+		Value = MakeShared<T>(Forward<ArgTypes>(Args)...);
+	}
+
+	void Reset()
+	{
+		Value.Reset();
+	}
 
 	FORCEINLINE bool IsSet() const
 	{
 		return Value.IsValid();
 	}
 
+	FORCEINLINE const T* Get() const
+	{
+		return Value.Get();
+	}
+
+	T* GetMutable()
+	{
+		if (Value.IsValid() && !Value.IsUnique())
+		{
+			Value = MakeShared<T>(*Value);
+		}
+
+		return Value.Get();
+	}
+
+private:
+	TSharedPtr<T> Value;
+};
+
+} // namespace SchemaOptionPrivate
+
+template <typename T>
+class TSchemaOption
+{
+	using FStorage = typename TChooseClass<TSchemaOptionUsesSharedStorage<T>::Value, SchemaOptionPrivate::TSharedStorage<T>, SchemaOptionPrivate::TInlineStorage<T>>::Result;
+
+public:
+	TSchemaOption() = default;
+	~TSchemaOption() = default;
+
+	TSchemaOption(const T& InValue)
+	{
+		Storage.Emplace(InValue);
+	}
+
+	TSchemaOption(T&& InValue)
+	{
+		Storage.Emplace(MoveTemp(InValue));
+	}
+
+	TSchemaOption(const TSchemaOption&) = default;
+	TSchemaOption(TSchemaOption&&) = default;
+
+	TSchemaOption& operator=(const TSchemaOption&) = default;
+	TSchemaOption& operator=(TSchemaOption&&) = default;
+
+	FORCEINLINE bool IsSet() const
+	{
+		return Storage.IsSet();
+	}
+
 	FORCEINLINE explicit operator bool() const
 	{
 		return IsSet();
@@ -55,25 +206,26 @@ public:
 	const T& GetValue() const
 	{
 		checkf(IsSet(), TEXT("It is an error to call GetValue() on an unset TSchemaOption. Please check IsSet()."));
-		return *Value;
+		return *Storage.Get();
 	}
 
 	T& GetValue()
 	{
 		checkf(IsSet(), TEXT("It is an error to call GetValue() on an unset TSchemaOption. Please check IsSet()."));
-		return *Value;
+		return *Storage.GetMutable();
 	}
 
 	bool operator==(const TSchemaOption& InValue) const
 	{
-		if (IsSet() != InValue.IsSet())
+		// Also covers both being unset, and shared values without comparing them.
+		if (Storage.Get() == InValue.Storage.Get())
 		{
-			return false;
+			return true;
 		}
 
-		if (!IsSet())
+		if (IsSet() != InValue.IsSet())
 		{
-			return true;
+			return false;
 		}
 
 		return GetValue() == InValue.GetValue();
@@ -84,23 +236,28 @@ public:
 		return !operator==(InValue);
 	}
 
-	T& operator*() const
+	const T& operator*() const
 	{
-		return *Value;
+		return *Storage.Get();
+	}
+
+	T& operator*()
+	{
+		return *Storage.GetMutable();
 	}
 
 	const T* operator->() const
 	{
-		return Value.Get();
+		return Storage.Get();
 	}
 
 	T* operator->()
 	{
-		return Value.Get();
+		return Storage.GetMutable();
 	}
 
 private:
-	TUniquePtr<T> Value;
+	FStorage Storage;
 };
 
 } // namespace SpatialGDK
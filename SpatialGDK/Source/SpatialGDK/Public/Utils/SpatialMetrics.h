@@ -17,6 +17,16 @@ class USpatialWorkerConnection;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatialMetrics, Log, All);
 
+// GDK subsystems whose game thread time is reported separately when bReportSubsystemLoad is set.
+enum class ESpatialLoadSubsystem : uint8
+{
+	OpProcessing,
+	Replication,
+	RPC,
+	Interest,
+	Count
+};
+
 UCLASS()
 class USpatialMetrics : public UObject
 {
@@ -47,6 +57,15 @@ public:
 	void TrackSentRPC(UFunction* Function, ESchemaComponentType RPCType, int PayloadSize);
 
 private:
+	friend class FSpatialLoadScope;
+
+	// Makes Subsystem the one game thread time is attributed to, and returns the previous one.
+	ESpatialLoadSubsystem EnterSubsystem(ESpatialLoadSubsystem Subsystem);
+	void ExitSubsystem(ESpatialLoadSubsystem PreviousSubsystem);
+	void AttributeSubsystemTime();
+
+	void SendMetrics();
+
 	UPROPERTY()
 	USpatialNetDriver* NetDriver;
 
@@ -58,6 +77,23 @@ private:
 	double AverageFPS;
 	double WorkerLoad;
 
+	// Wall clock frame time and game thread busy time, accumulated since the last report.
+	double FrameTimeSinceLastReport;
+	double BusyTimeSinceLastReport;
+
+	struct FLoadSample
+	{
+		int32 NumFrames;
+		double BusyTime;
+	};
+	// The last LoadSmoothingReportCount report intervals, oldest first.
+	TArray<FLoadSample> LoadSamples;
+
+	bool bTrackSubsystemLoad;
+	ESpatialLoadSubsystem ActiveSubsystem;
+	double ActiveSubsystemStartTime;
+	double SubsystemTimeSinceLastReport[static_cast<int32>(ESpatialLoadSubsystem::Count)];
+
 	// RPC tracking is activated with "SpatialStartRPCMetrics" and stopped with "SpatialStopRPCMetrics"
 	// console command. It will record every sent RPC as well as the size of its payload, and then display
 	// tracked data upon stopping. Calling these console commands on the client will also start/stop RPC
@@ -74,3 +110,30 @@ private:
 	float RPCTrackingStartTime;
 };
 
+// Attributes the game thread time spent in its scope to a GDK subsystem, for the subsystem load metrics.
+// Scopes can be nested, in which case the time is only attributed to the innermost one.
+class FSpatialLoadScope
+{
+public:
+	FSpatialLoadScope(USpatialMetrics* InMetrics, ESpatialLoadSubsystem Subsystem)
+		: Metrics(InMetrics != nullptr && InMetrics->bTrackSubsystemLoad ? InMetrics : nullptr)
+		, PreviousSubsystem(ESpatialLoadSubsystem::Count)
+	{
+		if (Metrics != nullptr)
+		{
+			PreviousSubsystem = Metrics->EnterSubsystem(Subsystem);
+		}
+	}
+
+	~FSpatialLoadScope()
+	{
+		if (Metrics != nullptr)
+		{
+			Metrics->ExitSubsystem(PreviousSubsystem);
+		}
+	}
+
+private:
+	USpatialMetrics* Metrics;
+	ESpatialLoadSubsystem PreviousSubsystem;
+};
@@ -0,0 +1,58 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "SpatialCommonTypes.h"
+
+using FUnresolvedObjectsSet = TSet<TWeakObjectPtr<const UObject>>;
+
+// Tracks outgoing property updates that are waiting on unresolved objects.
+// Entries are keyed by (channel, object, handle) and live in a flat pool that is recycled,
+// so queuing and resolving dependencies does not allocate per property once the pool has warmed up.
+class SPATIALGDK_API FUnresolvedObjectsTracker
+{
+public:
+	void QueueUpdate(const FChannelObjectPair& ChannelObjectPair, uint16 Handle, const FUnresolvedObjectsSet& UnresolvedObjects);
+	void ResetUpdate(const FChannelObjectPair& ChannelObjectPair, uint16 Handle);
+
+	// Removes the resolved object from all entries depending on it and appends the handles which have no remaining dependencies,
+	// grouped by the channel and object they belong to.
+	void ResolveObject(const UObject* Object, TMap<FChannelObjectPair, TArray<uint16>>& OutResolvedHandles);
+
+	bool HasPendingUpdate(const FChannelObjectPair& ChannelObjectPair, uint16 Handle) const;
+	int32 Num() const { return KeyToEntryIndex.Num(); }
+
+private:
+	struct FEntryKey
+	{
+		FChannelObjectPair ChannelObjectPair;
+		uint16 Handle;
+
+		bool operator==(const FEntryKey& Other) const
+		{
+			return Handle == Other.Handle && ChannelObjectPair == Other.ChannelObjectPair;
+		}
+
+		friend uint32 GetTypeHash(const FEntryKey& Key)
+		{
+			return HashCombine(GetTypeHash(Key.ChannelObjectPair), GetTypeHash(Key.Handle));
+		}
+	};
+
+	struct FEntry
+	{
+		FEntryKey Key;
+		TArray<TWeakObjectPtr<const UObject>, TInlineAllocator<4>> UnresolvedObjects;
+	};
+
+	int32 AllocateEntry();
+	void ReleaseEntry(int32 EntryIndex);
+
+	TArray<FEntry> Entries;
+	TArray<int32> FreeEntries;
+
+	TMap<FEntryKey, int32> KeyToEntryIndex;
+	TMultiMap<TWeakObjectPtr<const UObject>, int32> ObjectToEntryIndices;
+};
@@ -0,0 +1,27 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "SpatialCommonTypes.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+using WorkerRequirementSetHandle = TSharedRef<const WorkerRequirementSet>;
+
+// Interns worker requirement sets so that every EntityAcl referring to the same set shares a single copy.
+// Most entities in a deployment use a handful of distinct requirement sets (e.g. "any server", "owning client"),
+// so storing them per entity would duplicate the same attribute strings tens of thousands of times.
+// Sets are keyed on their serialized attributes, which lets the schema path look up an existing set without
+// constructing any FStrings. Only used from the game thread.
+class SPATIALGDK_API FWorkerRequirementSetPool
+{
+public:
+	static WorkerRequirementSetHandle Intern(const WorkerRequirementSet& RequirementSet);
+	static WorkerRequirementSetHandle InternFromSchema(Schema_Object* Object, Schema_FieldId Id);
+
+	// Releases the requirement sets that are no longer referenced by any ACL.
+	static void Purge();
+	static int32 Num();
+};
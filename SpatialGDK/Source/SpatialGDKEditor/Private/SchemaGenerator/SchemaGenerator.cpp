@@ -3,11 +3,16 @@
 #include "SchemaGenerator.h"
 
 #include "Algo/Reverse.h"
+#include "Async/ParallelFor.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Engine/SCS_Node.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeExit.h"
 #include "UObject/TextProperty.h"
 
 #include "Interop/SpatialClassInfoManager.h"
+#include "SpatialGDKEditorSchemaGenerator.h"
 #include "SpatialGDKSettings.h"
 #include "Utils/CodeWriter.h"
 #include "Utils/ComponentIdGenerator.h"
@@ -15,6 +20,78 @@
 
 DEFINE_LOG_CATEGORY(LogSchemaGenerator);
 
+namespace
+{
+// Filename and contents of the schema files generated so far, see QueueSchemaFile.
+TArray<TPair<FString, FString>> PendingSchemaFiles;
+}
+
+void QueueSchemaFile(const FString& Filename, const FCodeWriter& Writer)
+{
+	PendingSchemaFiles.Emplace(Filename, Writer.GetOutput());
+}
+
+int32 WritePendingSchemaFiles(FSchemaGenerationState& State)
+{
+	FThreadSafeCounter NumWrittenFiles;
+
+	State.NumFilesToWrite.Set(PendingSchemaFiles.Num());
+
+	ParallelFor(PendingSchemaFiles.Num(), [&NumWrittenFiles, &State](int32 Index)
+	{
+		if (State.bCancelled)
+		{
+			return;
+		}
+
+		ON_SCOPE_EXIT
+		{
+			State.NumFilesProcessed.Increment();
+		};
+
+		const FString& Filename = PendingSchemaFiles[Index].Key;
+		const FString& Contents = PendingSchemaFiles[Index].Value;
+
+		// Leave files that did not change untouched, so their timestamps stay the same and we can tell whether the schema needs recompiling.
+		FString ExistingContents;
+		if (FFileHelper::LoadFileToString(ExistingContents, *Filename) && ExistingContents == Contents)
+		{
+			return;
+		}
+
+		if (FFileHelper::SaveStringToFile(Contents, *Filename))
+		{
+			NumWrittenFiles.Increment();
+		}
+		else
+		{
+			UE_LOG(LogSchemaGenerator, Error, TEXT("Could not write schema file '%s'! Please make sure the file is writeable."), *Filename);
+		}
+	});
+
+	PendingSchemaFiles.Empty();
+
+	return NumWrittenFiles.GetValue();
+}
+
+// Returns the user-defined property group of a replicated property, given by the SpatialPropertyGroup metadata
+// on the top level property it belongs to, or NAME_None.
+FName GetSpatialPropertyGroup(TSharedPtr<FUnrealProperty> Property)
+{
+	while (TSharedPtr<FUnrealType> Container = Property->ContainerType.Pin())
+	{
+		TSharedPtr<FUnrealProperty> ParentProperty = Container->ParentProperty.Pin();
+		if (!ParentProperty.IsValid())
+		{
+			break;
+		}
+		Property = ParentProperty;
+	}
+
+	const FString& GroupName = Property->Property->GetMetaData(TEXT("SpatialPropertyGroup"));
+	return GroupName.IsEmpty() ? NAME_None : FName(*GroupName);
+}
+
 ESchemaComponentType PropertyGroupToSchemaComponentType(EReplicatedPropertyGroup Group)
 {
 	if (Group == REP_MultiClient)
@@ -374,7 +451,7 @@ void GenerateSubobjectSchema(FComponentIdGenerator& IdGenerator, UClass* Class,
 		SubobjectSchemaData.DynamicSubobjectComponents.Add(MoveTemp(DynamicSubobjectComponents));
 	}
 
-	Writer.WriteToFile(FString::Printf(TEXT("%s%s.schema"), *SchemaPath, *ClassPathToSchemaName[Class->GetPathName()]));
+	QueueSchemaFile(FString::Printf(TEXT("%s%s.schema"), *SchemaPath, *ClassPathToSchemaName[Class->GetPathName()]), Writer);
 	SubobjectSchemaData.GeneratedSchemaName = ClassPathToSchemaName[Class->GetPathName()];
 	SubobjectClassPathToSchema.Add(Class->GetPathName(), SubobjectSchemaData);
 }
@@ -400,6 +477,27 @@ void GenerateActorSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSha
 
 	FUnrealFlatRepData RepData = GetFlatRepData(TypeInfo);
 
+	// Split the multi-client properties tagged with a SpatialPropertyGroup into their own components.
+	TMap<FName, FCmdHandlePropertyMap> PropertyGroupRepData;
+	for (auto It = RepData[REP_MultiClient].CreateIterator(); It; ++It)
+	{
+		FName GroupName = GetSpatialPropertyGroup(It.Value());
+		if (GroupName != NAME_None)
+		{
+			PropertyGroupRepData.FindOrAdd(GroupName).Add(It.Key(), It.Value());
+			It.RemoveCurrent();
+		}
+	}
+
+	for (auto& RepProp : RepData[REP_SingleClient])
+	{
+		if (GetSpatialPropertyGroup(RepProp.Value) != NAME_None)
+		{
+			UE_LOG(LogSchemaGenerator, Warning, TEXT("SpatialPropertyGroup is not supported for owner only properties, ignoring it on %s::%s."),
+				*Class->GetName(), *RepProp.Value->Property->GetName());
+		}
+	}
+
 	// Client-server replicated properties.
 	for (EReplicatedPropertyGroup Group : GetAllReplicatedPropertyGroups())
 	{
@@ -452,6 +550,46 @@ void GenerateActorSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSha
 		Writer.Outdent().Print("}");
 	}
 
+	// User-defined property groups, replicated to clients by their own interest radius.
+	PropertyGroupRepData.KeySort(FNameLexicalLess());
+	for (auto& PropertyGroup : PropertyGroupRepData)
+	{
+		Worker_ComponentId ComponentId = 0;
+		if (SchemaData != nullptr)
+		{
+			if (const FPropertyGroupSchemaData* ExistingGroup = SchemaData->PropertyGroups.FindByPredicate([&PropertyGroup](const FPropertyGroupSchemaData& Existing) { return Existing.Name == PropertyGroup.Key; }))
+			{
+				ComponentId = ExistingGroup->ComponentId;
+			}
+		}
+		if (ComponentId == 0)
+		{
+			ComponentId = IdGenerator.Next();
+		}
+
+		Writer.PrintNewLine();
+
+		Writer.Printf("component {0}{1}Group {", *SchemaReplicatedDataName(REP_MultiClient, Class), *UnrealNameToSchemaComponentName(PropertyGroup.Key.ToString()));
+		Writer.Indent();
+		Writer.Printf("id = {0};", ComponentId);
+
+		FPropertyGroupSchemaData PropertyGroupData;
+		PropertyGroupData.Name = PropertyGroup.Key;
+		PropertyGroupData.ComponentId = ComponentId;
+
+		for (auto& RepProp : PropertyGroup.Value)
+		{
+			WriteSchemaRepField(Writer,
+				RepProp.Value,
+				RepProp.Value->ReplicationData->Handle);
+			PropertyGroupData.Handles.Add(RepProp.Value->ReplicationData->Handle);
+		}
+
+		Writer.Outdent().Print("}");
+
+		ActorSchemaData.PropertyGroups.Add(PropertyGroupData);
+	}
+
 	FCmdHandlePropertyMap HandoverData = GetFlatHandoverData(TypeInfo);
 	if (HandoverData.Num() > 0)
 	{
@@ -489,7 +627,7 @@ void GenerateActorSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSha
 
 	ActorClassPathToSchema.Add(Class->GetPathName(), ActorSchemaData);
 
-	Writer.WriteToFile(FString::Printf(TEXT("%s%s.schema"), *SchemaPath, *ClassPathToSchemaName[Class->GetPathName()]));
+	QueueSchemaFile(FString::Printf(TEXT("%s%s.schema"), *SchemaPath, *ClassPathToSchemaName[Class->GetPathName()]), Writer);
 }
 
 FActorSpecificSubobjectSchemaData GenerateSchemaForStaticallyAttachedSubobject(FCodeWriter& Writer, FComponentIdGenerator& IdGenerator, FString PropertyName, TSharedPtr<FUnrealType>& TypeInfo, UClass* ComponentClass, UClass* ActorClass, int MapIndex, const FActorSpecificSubobjectSchemaData* ExistingSchemaData)
@@ -615,7 +753,7 @@ void GenerateSubobjectSchemaForActor(FComponentIdGenerator& IdGenerator, UClass*
 
 	if (bHasComponents)
 	{
-		Writer.WriteToFile(FString::Printf(TEXT("%s%sComponents.schema"), *SchemaPath, *ClassPathToSchemaName[ActorClass->GetPathName()]));
+		QueueSchemaFile(FString::Printf(TEXT("%s%sComponents.schema"), *SchemaPath, *ClassPathToSchemaName[ActorClass->GetPathName()]), Writer);
 	}
 }
 
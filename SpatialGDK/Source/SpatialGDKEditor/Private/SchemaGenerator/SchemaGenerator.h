@@ -15,6 +15,12 @@ extern TMap<FString, FActorSchemaData> ActorClassPathToSchema;
 extern TMap<FString, FSubobjectSchemaData> SubobjectClassPathToSchema;
 extern TMap<FString, uint32> LevelPathToComponentId;
 
+// Queues the contents of Writer to be written to Filename by WritePendingSchemaFiles.
+void QueueSchemaFile(const FString& Filename, const FCodeWriter& Writer);
+// Writes all queued schema files in parallel, skipping files whose contents did not change. Returns the number of files written.
+// Files not written yet when State is cancelled are skipped.
+int32 WritePendingSchemaFiles(struct FSchemaGenerationState& State);
+
 // Generates schema for an Actor
 void GenerateActorSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSharedPtr<FUnrealType> TypeInfo, FString SchemaPath);
 // Generates schema for a Subobject class - the schema type and the dynamic schema components
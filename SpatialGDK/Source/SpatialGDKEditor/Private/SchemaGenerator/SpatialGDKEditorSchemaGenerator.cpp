@@ -44,6 +44,10 @@ TMap<FString, FActorSchemaData> ActorClassPathToSchema;
 TMap<FString, FSubobjectSchemaData> SubobjectClassPathToSchema;
 uint32 NextAvailableComponentId;
 
+// Persistent Actor class ids, see USchemaDatabase::ActorClassPathToClassId.
+TMap<FString, uint32> ActorClassPathToClassId;
+uint32 NextAvailableClassId = 1;
+
 // LevelStreaming
 TMap<FString, uint32> LevelPathToComponentId;
 TSet<uint32> LevelComponentIds;
@@ -350,7 +354,7 @@ void GenerateSchemaForSublevels(const FString& SchemaPath, FComponentIdGenerator
 		}
 	}
 
-	Writer.WriteToFile(FString::Printf(TEXT("%sSublevels/sublevels.schema"), *SchemaPath));
+	QueueSchemaFile(FString::Printf(TEXT("%sSublevels/sublevels.schema"), *SchemaPath), Writer);
 }
 
 FString GenerateIntermediateDirectory()
@@ -373,6 +377,11 @@ TMap<uint32, FString> CreateComponentIdToClassPathMap()
 			ComponentIdToClassPath.Add(ActorSchemaData.Value.SchemaComponents[Type], ActorSchemaData.Key);
 		});
 
+		for (const FPropertyGroupSchemaData& PropertyGroup : ActorSchemaData.Value.PropertyGroups)
+		{
+			ComponentIdToClassPath.Add(PropertyGroup.ComponentId, ActorSchemaData.Key);
+		}
+
 		for (const auto& SubobjectSchemaData : ActorSchemaData.Value.SubobjectData)
 		{
 			ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
@@ -398,8 +407,29 @@ TMap<uint32, FString> CreateComponentIdToClassPathMap()
 	return ComponentIdToClassPath;
 }
 
+void AssignActorClassIds()
+{
+	// Sorted so that classes generated together get the same ids regardless of map order.
+	TArray<FString> NewClassPaths;
+	for (const auto& ActorSchemaData : ActorClassPathToSchema)
+	{
+		if (!ActorClassPathToClassId.Contains(ActorSchemaData.Key))
+		{
+			NewClassPaths.Add(ActorSchemaData.Key);
+		}
+	}
+	NewClassPaths.Sort();
+
+	for (const FString& ClassPath : NewClassPaths)
+	{
+		ActorClassPathToClassId.Add(ClassPath, NextAvailableClassId++);
+	}
+}
+
 void SaveSchemaDatabase()
 {
+	check(IsInGameThread());
+
 	FString PackagePath = TEXT("/Game/Spatial/SchemaDatabase");
 	UPackage *Package = CreatePackage(nullptr, *PackagePath);
 
@@ -410,6 +440,8 @@ void SaveSchemaDatabase()
 	SchemaDatabase->LevelPathToComponentId = LevelPathToComponentId;
 	SchemaDatabase->ComponentIdToClassPath = CreateComponentIdToClassPathMap();
 	SchemaDatabase->LevelComponentIds = LevelComponentIds;
+	SchemaDatabase->ActorClassPathToClassId = ActorClassPathToClassId;
+	SchemaDatabase->NextAvailableClassId = NextAvailableClassId;
 
 	FAssetRegistryModule::AssetCreated(SchemaDatabase);
 	SchemaDatabase->MarkPackageDirty();
@@ -534,6 +566,7 @@ void ClearGeneratedSchema()
 	LevelComponentIds.Empty();
 	LevelPathToComponentId.Empty();
 	NextAvailableComponentId = SpatialConstants::STARTING_GENERATED_COMPONENT_ID;
+	// Actor class ids are kept, since entities in existing snapshots may still refer to them.
 
 	// As a safety precaution, if the SchemaDatabase.uasset doesn't exist then make sure the schema generated folder is cleared as well.
 	DeleteGeneratedSchemaFiles();
@@ -568,6 +601,8 @@ bool TryLoadExistingSchemaDatabase()
 		LevelComponentIds = SchemaDatabase->LevelComponentIds;
 		LevelPathToComponentId = SchemaDatabase->LevelPathToComponentId;
 		NextAvailableComponentId = SchemaDatabase->NextAvailableComponentId;
+		ActorClassPathToClassId = SchemaDatabase->ActorClassPathToClassId;
+		NextAvailableClassId = FMath::Max(SchemaDatabase->NextAvailableClassId, 1u);
 
 		// Component Id generation was updated to be non-destructive, if we detect an old schema database, delete it.
 		if (ActorClassPathToSchema.Num() > 0 && NextAvailableComponentId == SpatialConstants::STARTING_GENERATED_COMPONENT_ID)
@@ -628,17 +663,61 @@ void ResetUsedNames()
  	}
 }
 
-void RunSchemaCompiler()
+FString GetSchemaDescriptorPath()
+{
+	return FPaths::Combine(FSpatialGDKServicesModule::GetSpatialOSDirectory(), TEXT("build/assembly/schema/schema.descriptor"));
+}
+
+FString GetSchemaInputDirectory()
+{
+	return FPaths::Combine(FSpatialGDKServicesModule::GetSpatialOSDirectory(), TEXT("schema"));
+}
+
+FString GetCoreSDKSchemaDirectory()
+{
+	return FPaths::Combine(FSpatialGDKServicesModule::GetSpatialOSDirectory(), TEXT("build/dependencies/schema/standard_library"));
+}
+
+// Returns true if the schema descriptor is newer than every schema file passed to the schema_compiler. This covers the GDK
+// and user schema in the schema folder, which aren't written by the generator, as well as the core SDK schema.
+bool IsSchemaDescriptorUpToDate()
+{
+	const FDateTime DescriptorTimeStamp = IFileManager::Get().GetTimeStamp(*GetSchemaDescriptorPath());
+	if (DescriptorTimeStamp == FDateTime::MinValue())
+	{
+		return false;
+	}
+
+	const TArray<FString> SchemaInputDirs = { GetSchemaInputDirectory(), GetCoreSDKSchemaDirectory() };
+	for (const FString& SchemaInputDir : SchemaInputDirs)
+	{
+		TArray<FString> SchemaFiles;
+		IFileManager::Get().FindFilesRecursive(SchemaFiles, *SchemaInputDir, TEXT("*.schema"), true, false);
+
+		for (const FString& SchemaFile : SchemaFiles)
+		{
+			if (IFileManager::Get().GetTimeStamp(*SchemaFile) > DescriptorTimeStamp)
+			{
+				UE_LOG(LogSpatialGDKSchemaGenerator, Log, TEXT("%s is newer than the schema descriptor."), *SchemaFile);
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+void RunSchemaCompiler(const FSchemaGenerationState& State)
 {
 	FString PluginDir = GetDefault<USpatialGDKEditorSettings>()->GetGDKPluginDirectory();
 
 	// Get the schema_compiler path and arguments
 	FString SchemaCompilerExe = FPaths::Combine(PluginDir, TEXT("SpatialGDK/Binaries/ThirdParty/Improbable/Programs/schema_compiler.exe"));
 
-	FString SchemaDir = FPaths::Combine(FSpatialGDKServicesModule::GetSpatialOSDirectory(), TEXT("schema"));
-	FString CoreSDKSchemaDir = FPaths::Combine(FSpatialGDKServicesModule::GetSpatialOSDirectory(), TEXT("build/dependencies/schema/standard_library"));
-	FString SchemaDescriptorDir = FPaths::Combine(FSpatialGDKServicesModule::GetSpatialOSDirectory(), TEXT("build/assembly/schema"));
-	FString SchemaDescriptorOutput = FPaths::Combine(SchemaDescriptorDir, TEXT("schema.descriptor"));
+	FString SchemaDir = GetSchemaInputDirectory();
+	FString CoreSDKSchemaDir = GetCoreSDKSchemaDirectory();
+	FString SchemaDescriptorOutput = GetSchemaDescriptorPath();
+	FString SchemaDescriptorDir = FPaths::GetPath(SchemaDescriptorOutput);
 
 	// The schema_compiler cannot create folders.
 	if (!FPaths::DirectoryExists(SchemaDescriptorDir))
@@ -651,23 +730,83 @@ void RunSchemaCompiler()
 
 	UE_LOG(LogSpatialGDKSchemaGenerator, Log, TEXT("Starting '%s' with `%s` arguments."), *SchemaCompilerExe, *SchemaCompilerArgs);
 
+	void* ReadPipe = nullptr;
+	void* WritePipe = nullptr;
+	FPlatformProcess::CreatePipe(ReadPipe, WritePipe);
+
+	FProcHandle ProcHandle = FPlatformProcess::CreateProc(*SchemaCompilerExe, *SchemaCompilerArgs, false, true, true, nullptr, 0, nullptr, WritePipe);
+
 	int32 ExitCode = 1;
+	bool bCancelled = false;
 	FString SchemaCompilerOut;
-	FString SchemaCompilerErr;
-	FPlatformProcess::ExecProcess(*SchemaCompilerExe, *SchemaCompilerArgs, &ExitCode, &SchemaCompilerOut, &SchemaCompilerErr);
 
-	if (ExitCode == 0)
+	if (ProcHandle.IsValid())
+	{
+		// Poll rather than wait, so that the compiler can be stopped when schema generation is cancelled.
+		while (FPlatformProcess::IsProcRunning(ProcHandle))
+		{
+			if (State.bCancelled)
+			{
+				FPlatformProcess::TerminateProc(ProcHandle);
+				bCancelled = true;
+				break;
+			}
+
+			SchemaCompilerOut += FPlatformProcess::ReadPipe(ReadPipe);
+			FPlatformProcess::Sleep(0.05f);
+		}
+
+		SchemaCompilerOut += FPlatformProcess::ReadPipe(ReadPipe);
+		FPlatformProcess::GetProcReturnCode(ProcHandle, &ExitCode);
+		FPlatformProcess::CloseProc(ProcHandle);
+	}
+	else
+	{
+		UE_LOG(LogSpatialGDKSchemaGenerator, Error, TEXT("Could not start schema_compiler at '%s'."), *SchemaCompilerExe);
+	}
+
+	FPlatformProcess::ClosePipe(ReadPipe, WritePipe);
+
+	if (!bCancelled && ExitCode == 0)
 	{
 		UE_LOG(LogSpatialGDKSchemaGenerator, Log, TEXT("schema_compiler successfully generated schema descriptor: %s"), *SchemaCompilerOut);
+		return;
+	}
+
+	if (bCancelled)
+	{
+		UE_LOG(LogSpatialGDKSchemaGenerator, Warning, TEXT("schema_compiler was stopped because schema generation was cancelled."));
 	}
 	else
 	{
-		UE_LOG(LogSpatialGDKSchemaGenerator, Error, TEXT("schema_compiler failed to generate schema descriptor: %s"), *SchemaCompilerErr);
+		UE_LOG(LogSpatialGDKSchemaGenerator, Error, TEXT("schema_compiler failed to generate schema descriptor: %s"), *SchemaCompilerOut);
 	}
+
+	// Make sure the next schema generation compiles again, even if no schema files change in between.
+	IFileManager::Get().Delete(*SchemaDescriptorOutput);
 }
 
 bool SpatialGDKGenerateSchema()
 {
+	if (!SpatialGDKPrepareSchema())
+	{
+		return false;
+	}
+
+	FSchemaGenerationState State;
+	if (!SpatialGDKWriteAndCompileSchema(State))
+	{
+		return false;
+	}
+
+	SaveSchemaDatabase();
+	return true;
+}
+
+bool SpatialGDKPrepareSchema()
+{
+	check(IsInGameThread());
+
 	ResetUsedNames();
 
 	// Gets the classes currently loaded into memory.
@@ -703,13 +842,55 @@ bool SpatialGDKGenerateSchema()
 
 	FComponentIdGenerator IdGenerator = FComponentIdGenerator(NextAvailableComponentId);
 
+	// Component ids are assigned while generating, in class order, so this part stays serial to keep them deterministic.
+	double StartTime = FPlatformTime::Seconds();
 	GenerateSchemaFromClasses(TypeInfos, SchemaOutputPath, IdGenerator);
 	GenerateSchemaForSublevels(SchemaOutputPath, IdGenerator);
 	NextAvailableComponentId = IdGenerator.Peek();
-	SaveSchemaDatabase();
-	RunSchemaCompiler();
+	AssignActorClassIds();
+	double GeneratedTime = FPlatformTime::Seconds();
+
+	UE_LOG(LogSpatialGDKSchemaGenerator, Display, TEXT("Generated schema for %d classes in %.2fs."), TypeInfos.Num(), GeneratedTime - StartTime);
 
 	return true;
 }
 
+bool SpatialGDKWriteAndCompileSchema(FSchemaGenerationState& State)
+{
+	double StartTime = FPlatformTime::Seconds();
+	int32 NumWrittenFiles = WritePendingSchemaFiles(State);
+	double WrittenTime = FPlatformTime::Seconds();
+
+	if (State.bCancelled)
+	{
+		UE_LOG(LogSpatialGDKSchemaGenerator, Warning, TEXT("Schema generation cancelled after writing %d changed files."), NumWrittenFiles);
+
+		// Some schema files may have changed, so the descriptor has to be rebuilt by the next generation.
+		IFileManager::Get().Delete(*GetSchemaDescriptorPath());
+		return false;
+	}
+
+	// The descriptor only has to be rebuilt if any generated schema changed, or if any other input schema is newer than it.
+	// A missing descriptor (e.g. after a full scan cleared the build folder) is never up to date.
+	bool bCompiledSchema = false;
+	if (NumWrittenFiles > 0 || !IsSchemaDescriptorUpToDate())
+	{
+		State.bCompilingSchema = true;
+		RunSchemaCompiler(State);
+		bCompiledSchema = true;
+	}
+	else
+	{
+		UE_LOG(LogSpatialGDKSchemaGenerator, Log, TEXT("No schema files changed, skipping schema_compiler."));
+	}
+	double CompiledTime = FPlatformTime::Seconds();
+
+	UE_LOG(LogSpatialGDKSchemaGenerator, Display, TEXT("Wrote %d changed files in %.2fs, %s in %.2fs."),
+		NumWrittenFiles, WrittenTime - StartTime,
+		bCompiledSchema ? TEXT("compiled schema") : TEXT("skipped schema compilation"), CompiledTime - WrittenTime);
+
+	// A failing schema_compiler is logged, but as before doesn't fail the generation itself.
+	return !State.bCancelled;
+}
+
 #undef LOCTEXT_NAMESPACE
@@ -21,8 +21,13 @@
 #include "Utils/SnapshotGenerationTemplate.h"
 
 #include "EngineUtils.h"
+#include "HAL/FileManager.h"
 #include "HAL/PlatformFile.h"
 #include "HAL/PlatformFilemanager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/SecureHash.h"
+#include "Modules/ModuleManager.h"
 #include "UObject/UObjectIterator.h"
 
 #include <WorkerSDK/improbable/c_worker.h>
@@ -216,6 +221,74 @@ bool FillSnapshot(Worker_SnapshotOutputStream* OutputStream, UWorld* World)
 	return true;
 }
 
+namespace
+{
+
+FString GetSnapshotFingerprintPath(const FString& SnapshotFilename)
+{
+	return FPaths::Combine(FPaths::ProjectIntermediateDir(), TEXT("Improbable"), TEXT("SnapshotFingerprints"), SnapshotFilename + TEXT(".fingerprint"));
+}
+
+FString DescribeFile(const FString& Filename)
+{
+	IFileManager& FileManager = IFileManager::Get();
+	return FString::Printf(TEXT("%s %s %lld"), *Filename, *FileManager.GetTimeStamp(*Filename).ToString(), FileManager.FileSize(*Filename));
+}
+
+FString DescribeClassSource(const UClass* Class)
+{
+	if (Class->ClassGeneratedBy != nullptr)
+	{
+		// Blueprint class, changes with its package.
+		return DescribeFile(FPackageName::LongPackageNameToFilename(Class->GetOutermost()->GetName(), FPackageName::GetAssetPackageExtension()));
+	}
+
+	// Native class, changes with the module it is compiled into.
+	const FString ModuleName = FPackageName::GetShortName(Class->GetOutermost()->GetName());
+	return DescribeFile(FModuleManager::Get().GetModuleFilename(*ModuleName));
+}
+
+} // anonymous namespace
+
+FString SpatialGDKGetSnapshotFingerprint(const FString& MapPackageName)
+{
+	TArray<FString> Inputs;
+
+	Inputs.Add(DescribeFile(FPackageName::LongPackageNameToFilename(MapPackageName, FPackageName::GetMapPackageExtension())));
+	Inputs.Add(DescribeFile(FModuleManager::Get().GetModuleFilename(TEXT("SpatialGDK"))));
+	Inputs.Add(DescribeFile(FModuleManager::Get().GetModuleFilename(TEXT("SpatialGDKEditor"))));
+
+	TArray<FString> TemplateInputs;
+	for (TObjectIterator<UClass> SnapshotGenerationClass; SnapshotGenerationClass; ++SnapshotGenerationClass)
+	{
+		if (SnapshotGenerationClass->IsChildOf(USnapshotGenerationTemplate::StaticClass()) && *SnapshotGenerationClass != USnapshotGenerationTemplate::StaticClass())
+		{
+			TemplateInputs.Add(SnapshotGenerationClass->GetPathName() + TEXT(" ") + DescribeClassSource(*SnapshotGenerationClass));
+		}
+	}
+	TemplateInputs.Sort();
+	Inputs.Append(TemplateInputs);
+
+	for (const FName& WorkerType : GetDefault<USpatialGDKSettings>()->ServerWorkerTypes)
+	{
+		Inputs.Add(WorkerType.ToString());
+	}
+
+	return FMD5::HashAnsiString(*FString::Join(Inputs, TEXT("\n")));
+}
+
+bool SpatialGDKIsSnapshotUpToDate(const FString& SnapshotFilename, const FString& Fingerprint)
+{
+	const USpatialGDKEditorSettings* Settings = GetDefault<USpatialGDKEditorSettings>();
+	if (!FPaths::FileExists(FPaths::Combine(Settings->GetSpatialOSSnapshotFolderPath(), SnapshotFilename)))
+	{
+		return false;
+	}
+
+	FString RecordedFingerprint;
+	return FFileHelper::LoadFileToString(RecordedFingerprint, *GetSnapshotFingerprintPath(SnapshotFilename)) && RecordedFingerprint == Fingerprint;
+}
+
 bool SpatialGDKGenerateSnapshot(UWorld* World, FString SnapshotFilename)
 {
 	const USpatialGDKEditorSettings* Settings = GetDefault<USpatialGDKEditorSettings>();
@@ -245,5 +318,16 @@ bool SpatialGDKGenerateSnapshot(UWorld* World, FString SnapshotFilename)
 
 	Worker_SnapshotOutputStream_Destroy(OutputStream);
 
+	// Record what the snapshot was generated from, so unchanged maps can skip generation next time.
+	const FString FingerprintPath = GetSnapshotFingerprintPath(SnapshotFilename);
+	if (bSuccess && World != nullptr)
+	{
+		FFileHelper::SaveStringToFile(SpatialGDKGetSnapshotFingerprint(World->GetOutermost()->GetName()), *FingerprintPath);
+	}
+	else
+	{
+		IFileManager::Get().Delete(*FingerprintPath, /* RequireExists */ false, /* EvenReadOnly */ true, /* Quiet */ true);
+	}
+
 	return bSuccess;
 }
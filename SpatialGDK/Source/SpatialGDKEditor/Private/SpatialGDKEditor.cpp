@@ -22,7 +22,7 @@ DEFINE_LOG_CATEGORY(LogSpatialGDKEditor);
 
 #define LOCTEXT_NAMESPACE "FSpatialGDKEditor"
 
-bool FSpatialGDKEditor::GenerateSchema(bool bFullScan)
+bool FSpatialGDKEditor::PrepareSchemaGeneration(bool bFullScan)
 {
 	if (bSchemaGeneratorRunning)
 	{
@@ -94,7 +94,7 @@ bool FSpatialGDKEditor::GenerateSchema(bool bFullScan)
 	}
 
 	Progress.EnterProgressFrame(bFullScan ? 10.f : 100.f);
-	bool bResult = SpatialGDKGenerateSchema();
+	bool bResult = SpatialGDKPrepareSchema();
 	
 	// We delay printing this error until after the schema spam to make it have a higher chance of being noticed.
 	if (ErroredBlueprints.Num() > 0)
@@ -114,20 +114,110 @@ bool FSpatialGDKEditor::GenerateSchema(bool bFullScan)
 	}
 
 	GetMutableDefault<UGeneralProjectSettings>()->bSpatialNetworking = bCachedSpatialNetworking;
+
+	if (!bResult)
+	{
+		FinishSchemaGeneration(false);
+	}
+
+	return bResult;
+}
+
+void FSpatialGDKEditor::FinishSchemaGeneration(bool bResult)
+{
 	bSchemaGeneratorRunning = false;
+	SchemaGenerationState.Reset();
 
 	if (bResult)
 	{
+		SaveSchemaDatabase();
 		UE_LOG(LogSpatialGDKEditor, Display, TEXT("Schema Generation succeeded!"));
 	}
 	else
 	{
 		UE_LOG(LogSpatialGDKEditor, Error, TEXT("Schema Generation failed. View earlier log messages for errors."));
 	}
+}
+
+bool FSpatialGDKEditor::GenerateSchema(bool bFullScan)
+{
+	if (!PrepareSchemaGeneration(bFullScan))
+	{
+		return false;
+	}
+
+	FSchemaGenerationState State;
+	bool bResult = SpatialGDKWriteAndCompileSchema(State);
+	FinishSchemaGeneration(bResult);
 
 	return bResult;
 }
 
+void FSpatialGDKEditor::GenerateSchemaAsync(bool bFullScan, FSimpleDelegate SuccessCallback, FSimpleDelegate FailureCallback)
+{
+	if (!PrepareSchemaGeneration(bFullScan))
+	{
+		FailureCallback.ExecuteIfBound();
+		return;
+	}
+
+	SchemaGenerationState = MakeShared<FSchemaGenerationState, ESPMode::ThreadSafe>();
+
+	TSharedPtr<FSchemaGenerationState, ESPMode::ThreadSafe> State = SchemaGenerationState;
+	SchemaGeneratorResult = Async<bool>(EAsyncExecution::Thread, [State]
+		{
+			return SpatialGDKWriteAndCompileSchema(*State);
+		},
+		[this, SuccessCallback, FailureCallback]
+		{
+			// The completion callback runs on the background thread, but the callbacks usually update the editor UI.
+			AsyncTask(ENamedThreads::GameThread, [this, SuccessCallback, FailureCallback]
+			{
+				const bool bResult = SchemaGeneratorResult.IsReady() && SchemaGeneratorResult.Get();
+				FinishSchemaGeneration(bResult);
+
+				if (bResult)
+				{
+					SuccessCallback.ExecuteIfBound();
+				}
+				else
+				{
+					FailureCallback.ExecuteIfBound();
+				}
+			});
+		});
+}
+
+void FSpatialGDKEditor::CancelSchemaGeneration()
+{
+	if (SchemaGenerationState.IsValid())
+	{
+		UE_LOG(LogSpatialGDKEditor, Display, TEXT("Cancelling schema generation."));
+		SchemaGenerationState->bCancelled = true;
+	}
+}
+
+FString FSpatialGDKEditor::GetSchemaGenerationStatus() const
+{
+	if (!SchemaGenerationState.IsValid())
+	{
+		return FString();
+	}
+
+	if (SchemaGenerationState->bCancelled)
+	{
+		return TEXT("Cancelling...");
+	}
+
+	if (SchemaGenerationState->bCompilingSchema)
+	{
+		return TEXT("Compiling schema...");
+	}
+
+	return FString::Printf(TEXT("Writing schema files (%d/%d)"), SchemaGenerationState->NumFilesProcessed.GetValue(), SchemaGenerationState->NumFilesToWrite.GetValue());
+}
+
+
 bool FSpatialGDKEditor::LoadPotentialAssets(TArray<TStrongObjectPtr<UObject>>& OutAssets)
 {
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
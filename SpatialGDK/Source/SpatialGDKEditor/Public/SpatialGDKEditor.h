@@ -6,6 +6,8 @@
 #include "CoreMinimal.h"
 #include "UObject/StrongObjectPtr.h"
 
+struct FSchemaGenerationState;
+
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatialGDKEditor, Log, All);
 
 DECLARE_DELEGATE_OneParam(FSpatialGDKEditorErrorHandler, FString);
@@ -18,6 +20,11 @@ public:
 	}
 
 	bool GenerateSchema(bool bFullScan);
+	// Same as GenerateSchema, but only blocks the editor while loading classes and generating their schema. Writing the schema files and running
+	// schema_compiler happens on a background thread, the callbacks are invoked on the game thread once it finished.
+	void GenerateSchemaAsync(bool bFullScan, FSimpleDelegate SuccessCallback, FSimpleDelegate FailureCallback);
+	void CancelSchemaGeneration();
+	FString GetSchemaGenerationStatus() const;
 	void GenerateSnapshot(UWorld* World, FString SnapshotFilename, FSimpleDelegate SuccessCallback, FSimpleDelegate FailureCallback, FSpatialGDKEditorErrorHandler ErrorCallback);
 	void LaunchCloudDeployment(FSimpleDelegate SuccessCallback, FSimpleDelegate FailureCallback);
 	void StopCloudDeployment(FSimpleDelegate SuccessCallback, FSimpleDelegate FailureCallback);
@@ -28,9 +35,13 @@ public:
 private:
 	bool bSchemaGeneratorRunning;
 	TFuture<bool> SchemaGeneratorResult;
+	TSharedPtr<FSchemaGenerationState, ESPMode::ThreadSafe> SchemaGenerationState;
 	TFuture<bool> LaunchCloudResult;
 	TFuture<bool> StopCloudResult;
 
+	bool PrepareSchemaGeneration(bool bFullScan);
+	void FinishSchemaGeneration(bool bResult);
+
 	bool LoadPotentialAssets(TArray<TStrongObjectPtr<UObject>>& OutAssets);
 
 	FDelegateHandle OnAssetLoadedHandle;
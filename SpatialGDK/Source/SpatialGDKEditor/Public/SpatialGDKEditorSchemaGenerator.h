@@ -2,12 +2,36 @@
 
 #pragma once
 
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
 #include "Logging/LogMacros.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatialGDKSchemaGenerator, Log, All);
 
+// Progress and cancellation of the part of schema generation that can run in the background, see SpatialGDKWriteAndCompileSchema.
+struct FSchemaGenerationState
+{
+	FThreadSafeBool bCancelled;
+	FThreadSafeCounter NumFilesToWrite;
+	FThreadSafeCounter NumFilesProcessed;
+	FThreadSafeBool bCompilingSchema;
+};
+
+// Generates the schema for all loaded classes, writes it and runs schema_compiler. Equivalent to SpatialGDKPrepareSchema followed by SpatialGDKWriteAndCompileSchema.
 SPATIALGDKEDITOR_API bool SpatialGDKGenerateSchema();
 
+// Discovers the supported classes and generates their schema. Needs access to UObjects, so must run on the game thread.
+// Nothing is written to the schema folder or the schema database until SpatialGDKWriteAndCompileSchema and SaveSchemaDatabase are called.
+SPATIALGDKEDITOR_API bool SpatialGDKPrepareSchema();
+
+// Writes the schema generated by SpatialGDKPrepareSchema and runs schema_compiler if any file changed. Doesn't touch UObjects, so it can run on
+// a background thread while the editor stays responsive. Returns false if State was cancelled.
+SPATIALGDKEDITOR_API bool SpatialGDKWriteAndCompileSchema(FSchemaGenerationState& State);
+
+// Saves the ids assigned by SpatialGDKPrepareSchema to the schema database. Should only be called on the game thread, once the schema has been
+// written successfully, so a failed or cancelled generation doesn't leave the database referring to schema that was never written.
+SPATIALGDKEDITOR_API void SaveSchemaDatabase();
+
 SPATIALGDKEDITOR_API void ClearGeneratedSchema();
 
 SPATIALGDKEDITOR_API void DeleteGeneratedSchemaFiles();
@@ -7,3 +7,10 @@
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatialGDKSnapshot, Log, All);
 
 SPATIALGDKEDITOR_API bool SpatialGDKGenerateSnapshot(class UWorld* World, FString SnapshotFilename);
+
+// Hash of everything a map's snapshot is generated from: the map package, the snapshot generation template classes and the
+// GDK code and settings they depend on. It is recorded for every generated snapshot.
+SPATIALGDKEDITOR_API FString SpatialGDKGetSnapshotFingerprint(const FString& MapPackageName);
+
+// Returns true if the snapshot exists and was generated from inputs with the given fingerprint, so it can be reused as is.
+SPATIALGDKEDITOR_API bool SpatialGDKIsSnapshotUpToDate(const FString& SnapshotFilename, const FString& Fingerprint);
@@ -3,6 +3,7 @@
 #include "GenerateSnapshotCommandlet.h"
 #include "SpatialGDKEditorCommandletPrivate.h"
 #include "SpatialGDKEditor.h"
+#include "SpatialGDKEditorSnapshotGenerator.h"
 
 #include "Kismet/GameplayStatics.h"
 #include "Engine/ObjectLibrary.h"
@@ -28,6 +29,8 @@ int32 UGenerateSnapshotCommandlet::Main(const FString& Args)
 	// TMap<FString, FString> Params;
 	// ParseCommandLine(*Args, Tokens, Switches, Params);
 
+	bForceGeneration = FParse::Param(*Args, TEXT("ForceGeneration"));
+
 	bool bSnapshotGenSuccess = GenerateSnapshots();
 
 	UE_LOG(LogSpatialGDKEditorCommandlet, Display, TEXT("Snapshot Generation Commandlet Complete"));
@@ -54,6 +57,15 @@ bool UGenerateSnapshotCommandlet::GenerateSnapshots()
 
 bool UGenerateSnapshotCommandlet::GenerateSnapshotForMap(FString MapPath)
 {
+	const FString SnapshotFilename = FPaths::SetExtension(FPaths::GetCleanFilename(MapPath), TEXT(".snapshot"));
+
+	// The fingerprint covers every input of snapshot generation, so an up to date snapshot can be kept without loading the map.
+	if (!bForceGeneration && SpatialGDKIsSnapshotUpToDate(SnapshotFilename, SpatialGDKGetSnapshotFingerprint(MapPath)))
+	{
+		UE_LOG(LogSpatialGDKEditorCommandlet, Display, TEXT("Snapshot for %s is up to date, skipping"), *MapPath);
+		return true;
+	}
+
 	UE_LOG(LogSpatialGDKEditorCommandlet, Display, TEXT("Generating Snapshot for %s"), *MapPath);
 
 	// Load the World
@@ -66,7 +78,7 @@ bool UGenerateSnapshotCommandlet::GenerateSnapshotForMap(FString MapPath)
 	bool bSnapshotGenSuccess = false;
 	FSpatialGDKEditor SpatialGDKEditor;
 	SpatialGDKEditor.GenerateSnapshot(
-		GWorld, FPaths::SetExtension(FPaths::GetCleanFilename(MapPath), TEXT(".snapshot")),
+		GWorld, SnapshotFilename,
 		FSimpleDelegate::CreateLambda([&bSnapshotGenSuccess]()
 		{
 			UE_LOG(LogSpatialGDKEditorCommandlet, Display, TEXT("Success!"));
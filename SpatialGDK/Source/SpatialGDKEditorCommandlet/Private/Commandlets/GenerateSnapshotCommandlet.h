@@ -21,4 +21,7 @@ private:
 	bool GenerateSnapshots();
 	bool GenerateSnapshotForMap(FString WorldPath);
 	TArray<FString> GetAllMapPaths(FString InMapsPath);
+
+	// Regenerate snapshots even if their inputs have not changed since they were last generated.
+	bool bForceGeneration = false;
 };
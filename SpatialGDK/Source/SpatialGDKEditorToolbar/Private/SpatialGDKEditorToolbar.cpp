@@ -44,6 +44,7 @@ DEFINE_LOG_CATEGORY(LogSpatialGDKEditorToolbar);
 
 FSpatialGDKEditorToolbarModule::FSpatialGDKEditorToolbarModule()
 : bStopSpatialOnExit(false)
+, bStartDeploymentAfterSchemaGeneration(false)
 {
 }
 
@@ -129,6 +130,13 @@ void FSpatialGDKEditorToolbarModule::PreUnloadCallback()
 
 void FSpatialGDKEditorToolbarModule::Tick(float DeltaTime)
 {
+	TSharedPtr<SNotificationItem> SchemaGenerationNotification = SchemaGenerationNotificationPtr.Pin();
+	if (SchemaGenerationNotification.IsValid() && SchemaGenerationNotification == TaskNotificationPtr.Pin()
+		&& SpatialGDKEditorInstance.IsValid() && SpatialGDKEditorInstance->IsSchemaGeneratorRunning())
+	{
+		const FString Status = SpatialGDKEditorInstance->GetSchemaGenerationStatus();
+		SchemaGenerationNotification->SetText(FText::AsCultureInvariant(Status.IsEmpty() ? SchemaGenerationNotificationText : FString::Printf(TEXT("%s\n%s"), *SchemaGenerationNotificationText, *Status)));
+	}
 }
 
 bool FSpatialGDKEditorToolbarModule::CanExecuteSchemaGenerator() const
@@ -304,7 +312,7 @@ void FSpatialGDKEditorToolbarModule::OnShowTaskStartNotification(const FString&
 	});
 }
 
-void FSpatialGDKEditorToolbarModule::ShowTaskStartNotification(const FString& NotificationText)
+void FSpatialGDKEditorToolbarModule::ShowTaskStartNotification(const FString& NotificationText, FSimpleDelegate CancelCallback)
 {
 	// If a task notification already exists then expire it.
 	if (TaskNotificationPtr.IsValid())
@@ -322,6 +330,11 @@ void FSpatialGDKEditorToolbarModule::ShowTaskStartNotification(const FString& No
 	Info.ExpireDuration = 5.0f;
 	Info.bFireAndForget = false;
 
+	if (CancelCallback.IsBound())
+	{
+		Info.ButtonDetails.Add(FNotificationButtonInfo(LOCTEXT("CancelTask", "Cancel"), FText::GetEmpty(), CancelCallback, SNotificationItem::CS_Pending));
+	}
+
 	TaskNotificationPtr = FSlateNotificationManager::Get().AddNotification(Info);
 
 	if (TaskNotificationPtr.IsValid())
@@ -530,6 +543,14 @@ void FSpatialGDKEditorToolbarModule::VerifyAndStartDeployment()
 		return;
 	}
 
+	// The deployment would load a schema descriptor that is still being written, so wait for schema generation to finish.
+	if (SpatialGDKEditorInstance.IsValid() && SpatialGDKEditorInstance->IsSchemaGeneratorRunning())
+	{
+		UE_LOG(LogSpatialGDKEditorToolbar, Log, TEXT("Schema generation is running, the local deployment will start once it has finished."));
+		bStartDeploymentAfterSchemaGeneration = true;
+		return;
+	}
+
 	// Get the latest launch config.
 	const USpatialGDKEditorSettings* SpatialGDKSettings = GetDefault<USpatialGDKEditorSettings>();
 
@@ -639,7 +660,8 @@ bool FSpatialGDKEditorToolbarModule::StartSpatialDeploymentIsVisible() const
 
 bool FSpatialGDKEditorToolbarModule::StartSpatialDeploymentCanExecute() const
 {
-	return !LocalDeploymentManager->IsDeploymentStarting() && GetDefault<UGeneralProjectSettings>()->bSpatialNetworking;
+	return !LocalDeploymentManager->IsDeploymentStarting() && GetDefault<UGeneralProjectSettings>()->bSpatialNetworking
+		&& !(SpatialGDKEditorInstance.IsValid() && SpatialGDKEditorInstance->IsSchemaGeneratorRunning());
 }
 
 bool FSpatialGDKEditorToolbarModule::StopSpatialDeploymentIsVisible() const
@@ -860,45 +882,55 @@ void FSpatialGDKEditorToolbarModule::GenerateSchema(bool bFullScan)
 {
 	LocalDeploymentManager->SetRedeployRequired();
 
+	FString SuccessText;
+	FString FailureText;
+
 	if (SpatialGDKEditorInstance->FullScanRequired())
 	{
-		OnShowTaskStartNotification("Initial Schema Generation");
-
-		if (SpatialGDKEditorInstance->GenerateSchema(true))
-		{
-			OnShowSuccessNotification("Initial Schema Generation completed!");
-		}
-		else
-		{
-			OnShowFailedNotification("Initial Schema Generation failed");
-		}
+		bFullScan = true;
+		SchemaGenerationNotificationText = TEXT("Initial Schema Generation");
+		SuccessText = TEXT("Initial Schema Generation completed!");
+		FailureText = TEXT("Initial Schema Generation failed");
 	}
 	else if (bFullScan)
 	{
-		OnShowTaskStartNotification("Generating Schema (Full)");
-
-		if (SpatialGDKEditorInstance->GenerateSchema(true))
-		{
-			OnShowSuccessNotification("Full Schema Generation completed!");
-		}
-		else
-		{
-			OnShowFailedNotification("Full Schema Generation failed");
-		}
+		SchemaGenerationNotificationText = TEXT("Generating Schema (Full)");
+		SuccessText = TEXT("Full Schema Generation completed!");
+		FailureText = TEXT("Full Schema Generation failed");
 	}
 	else
 	{
-		OnShowTaskStartNotification("Generating Schema (Incremental)");
+		SchemaGenerationNotificationText = TEXT("Generating Schema (Incremental)");
+		SuccessText = TEXT("Incremental Schema Generation completed!");
+		FailureText = TEXT("Incremental Schema Generation failed");
+	}
+
+	// Shown directly rather than through OnShowTaskStartNotification, so it is visible while the schema is written in the background.
+	ShowTaskStartNotification(SchemaGenerationNotificationText, FSimpleDelegate::CreateLambda([this]
+	{
+		SpatialGDKEditorInstance->CancelSchemaGeneration();
+	}));
+	SchemaGenerationNotificationPtr = TaskNotificationPtr;
 
-		if (SpatialGDKEditorInstance->GenerateSchema(false))
+	SpatialGDKEditorInstance->GenerateSchemaAsync(bFullScan,
+		FSimpleDelegate::CreateLambda([this, SuccessText]()
 		{
-			OnShowSuccessNotification("Incremental Schema Generation completed!");
-		}
-		else
+			OnShowSuccessNotification(SuccessText);
+			if (bStartDeploymentAfterSchemaGeneration)
+			{
+				bStartDeploymentAfterSchemaGeneration = false;
+				VerifyAndStartDeployment();
+			}
+		}),
+		FSimpleDelegate::CreateLambda([this, FailureText]()
 		{
-			OnShowFailedNotification("Incremental Schema Generation failed");
-		}
-	}
+			OnShowFailedNotification(FailureText);
+			if (bStartDeploymentAfterSchemaGeneration)
+			{
+				bStartDeploymentAfterSchemaGeneration = false;
+				UE_LOG(LogSpatialGDKEditorToolbar, Warning, TEXT("Schema generation did not complete, the queued local deployment was not started."));
+			}
+		}));
 }
 
 bool FSpatialGDKEditorToolbarModule::WriteFlagSection(TSharedRef< TJsonWriter<> > Writer, const FString& Key, const FString& Value) const
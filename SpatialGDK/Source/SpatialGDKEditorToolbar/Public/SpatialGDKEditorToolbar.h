@@ -85,7 +85,7 @@ private:
 	TSharedRef<SWidget> CreateGenerateSchemaMenuContent();
 
 	void OnShowTaskStartNotification(const FString& NotificationText);
-	void ShowTaskStartNotification(const FString& NotificationText);
+	void ShowTaskStartNotification(const FString& NotificationText, FSimpleDelegate CancelCallback = FSimpleDelegate());
 
 	void OnShowSuccessNotification(const FString& NotificationText);
 	void ShowSuccessNotification(const FString& NotificationText);
@@ -111,6 +111,13 @@ private:
 
 	TWeakPtr<SNotificationItem> TaskNotificationPtr;
 
+	// Notification of the running schema generation, updated with its progress while the schema is written and compiled in the background.
+	TWeakPtr<SNotificationItem> SchemaGenerationNotificationPtr;
+	FString SchemaGenerationNotificationText;
+
+	// Set when a local deployment was requested while schema generation was running. The deployment starts once generation succeeds.
+	bool bStartDeploymentAfterSchemaGeneration;
+
 	// Sounds used for execution of tasks.
 	USoundBase* ExecutionStartSound;
 	USoundBase* ExecutionSuccessSound;